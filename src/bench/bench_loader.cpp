@@ -0,0 +1,131 @@
+// BENCH_LOADER.CPP - Аллокации и пиковая память FileReader::ReadMesh
+//
+// ЗАЧЕМ НУЖЕН:
+// FileReader хранит временные буферы разбора (ObjParseResult, куски ObjParser,
+// таблица EdgeBuilder) между загрузками, а массивы координат переносит в Mesh
+// без копирования. Бенчмарк показывает для каждого режима разбора:
+// - число выделений памяти на первую и на повторную загрузку
+// - пик занятой кучи во время загрузки относительно памяти итогового Mesh
+//   (Mesh::GetMemoryBytes: координаты, ребра, треугольники и нормали граней;
+//   кэш выключен, поэтому внешней памяти у Mesh нет)
+//
+// ЗАПУСК:
+// ./bench_loader model1.obj [model2.obj ...]
+//
+// Все в namespace s21
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "../model/io.h"
+
+// Подсчет выделений и занятой памяти: размер блока хранится перед ним
+namespace {
+
+constexpr size_t kHeader = alignof(std::max_align_t);
+
+std::atomic<size_t> g_allocations{0};
+std::atomic<size_t> g_live_bytes{0};
+std::atomic<size_t> g_peak_bytes{0};
+
+void* countedAlloc(size_t size) {
+    char* block = static_cast<char*>(std::malloc(size + kHeader));
+    if (!block) throw std::bad_alloc();
+    *reinterpret_cast<size_t*>(block) = size;
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    size_t live = g_live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    size_t peak = g_peak_bytes.load(std::memory_order_relaxed);
+    while (live > peak && !g_peak_bytes.compare_exchange_weak(peak, live)) {
+    }
+    return block + kHeader;
+}
+
+void countedFree(void* p) {
+    if (!p) return;
+    char* block = static_cast<char*>(p) - kHeader;
+    g_live_bytes.fetch_sub(*reinterpret_cast<size_t*>(block), std::memory_order_relaxed);
+    std::free(block);
+}
+
+}  // namespace
+
+void* operator new(size_t size) { return countedAlloc(size); }
+void* operator new[](size_t size) { return countedAlloc(size); }
+void operator delete(void* p) noexcept { countedFree(p); }
+void operator delete[](void* p) noexcept { countedFree(p); }
+void operator delete(void* p, size_t) noexcept { countedFree(p); }
+void operator delete[](void* p, size_t) noexcept { countedFree(p); }
+
+namespace s21 {
+
+namespace {
+
+constexpr int kWarmLoads = 3;
+
+double megabytes(size_t bytes) { return bytes / (1024.0 * 1024.0); }
+
+struct LoadStats {
+    size_t allocations = 0;
+    size_t peak_bytes = 0;   // Пик сверх памяти, занятой до загрузки
+    size_t mesh_bytes = 0;
+    double milliseconds = 0.0;
+    bool success = false;
+};
+
+LoadStats measureLoad(FileReader& reader, const std::string& path) {
+    LoadStats stats;
+    size_t baseline = g_live_bytes.load();
+    g_peak_bytes.store(baseline);
+    size_t allocationsBefore = g_allocations.load();
+    auto start = std::chrono::steady_clock::now();
+    {
+        FacadeOperationResult result = reader.ReadMesh(path, NormalizationParameters());
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        stats.milliseconds = elapsed.count();
+        stats.allocations = g_allocations.load() - allocationsBefore;
+        stats.peak_bytes = g_peak_bytes.load() - baseline;
+        stats.success = result.IsSuccess();
+        const Mesh& mesh = result.GetMesh();
+        stats.mesh_bytes = mesh.GetMemoryBytes();
+    }
+    return stats;
+}
+
+void printStats(const char* name, const LoadStats& stats) {
+    std::printf("  %-16s %8zu allocations  %8.1f ms  peak %8.1f MB  (x%.2f of mesh %.1f MB)%s\n",
+                name, stats.allocations, stats.milliseconds, megabytes(stats.peak_bytes),
+                stats.mesh_bytes ? double(stats.peak_bytes) / stats.mesh_bytes : 0.0,
+                megabytes(stats.mesh_bytes), stats.success ? "" : "  FAILED");
+}
+
+void benchMode(const std::string& path, FileReader::ParseMode mode, const char* name) {
+    FileReader reader;
+    reader.SetParseMode(mode);
+    reader.SetCacheEnabled(false);
+
+    std::printf(" %s\n", name);
+    printStats("first load", measureLoad(reader, path));
+    LoadStats warm;
+    for (int i = 0; i < kWarmLoads; ++i) warm = measureLoad(reader, path);
+    printStats("repeated load", warm);
+}
+
+}  // namespace
+
+}  // namespace s21
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::printf("Usage: %s model.obj [model.obj ...]\n", argv[0]);
+        return 1;
+    }
+    for (int i = 1; i < argc; ++i) {
+        std::printf("%s\n", argv[i]);
+        s21::benchMode(argv[i], s21::FileReader::ParseMode::kMapped, "kMapped");
+        s21::benchMode(argv[i], s21::FileReader::ParseMode::kStream, "kStream");
+    }
+    return 0;
+}
@@ -0,0 +1,76 @@
+// BENCH_MAT4.CPP - Замер построения матриц трансформации
+//
+// ЗАЧЕМ НУЖЕН:
+// Проверяет, что построение матриц перемещения/поворота/масштабирования
+// Mat4 (TransformMatrixBuilder - однострочные обертки над ними) не
+// выделяет память, и замеряет время построения одной матрицы.
+// Зависит только от mat4.h (без geometry.h и остальной модели).
+//
+// ЗАПУСК:
+// ./bench_mat4
+// Код возврата 1, если при построении матриц была хотя бы одна аллокация.
+//
+// Все в namespace s21
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "../model/mat4.h"
+
+// Подсчет всех выделений памяти в процессе
+static std::atomic<size_t> g_allocations{0};
+
+void* operator new(size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+namespace s21 {
+
+namespace {
+
+constexpr int kIterations = 1'000'000;
+
+// Не дает компилятору выбросить результат
+volatile double g_sink = 0.0;
+
+template <typename Build>
+void benchBuild(const char* name, Build&& build) {
+    size_t before = g_allocations.load();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        Mat4 matrix = build(i * 1e-6);
+        g_sink = g_sink + matrix(0, 3) + matrix(1, 1);
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    size_t allocations = g_allocations.load() - before;
+    std::printf("  %-10s %8.2f ns/matrix  %8.3f allocations/matrix\n", name,
+                elapsed.count() / kIterations, double(allocations) / kIterations);
+}
+
+}  // namespace
+
+}  // namespace s21
+
+int main() {
+    using namespace s21;
+    size_t before = g_allocations.load();
+
+    std::printf("Mat4 (%d matrices each):\n", kIterations);
+    benchBuild("move", [](double t) { return Mat4::Translation(t, 2 * t, 3 * t); });
+    benchBuild("rotate", [](double t) { return Mat4::Rotation(t, 2 * t, 3 * t); });
+    benchBuild("scale", [](double t) { return Mat4::Scale(1 + t, 1 - t, 1); });
+    benchBuild("compose", [](double t) { return Mat4::Translation(t, 0, 0) * Mat4::Rotation(t, t, t); });
+
+    // printf не выделяет память через operator new, поэтому счетчик точный
+    size_t total = g_allocations.load() - before;
+    std::printf("Heap allocations while building matrices: %zu\n", total);
+    return total == 0 ? 0 : 1;
+}
@@ -0,0 +1,112 @@
+// BENCH_OBJ_PARSER.CPP - Замер пропускной способности загрузки OBJ
+//
+// ЗАЧЕМ НУЖЕН:
+// Сравнивает построчный (kStream) и параллельный (kMapped) режимы
+// FileReader::ReadMesh на одних и тех же файлах и выводит скорость в МБ/с.
+// Дополнительно проверяет, что оба режима и загрузка из бинарного кэша
+// дают одинаковый Mesh.
+//
+// ЗАПУСК:
+// ./bench_obj_parser model1.obj [model2.obj ...]
+//
+// Все в namespace s21
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+
+#include "../model/io.h"
+#include "../model/mapped_file.h"
+#include "../model/obj_parser.h"
+
+namespace s21 {
+
+namespace {
+
+constexpr int kRepeats = 3;
+
+double megabytes(size_t bytes) { return bytes / (1024.0 * 1024.0); }
+
+template <typename Fn>
+double bestSeconds(Fn&& fn) {
+    double best = 1e300;
+    for (int i = 0; i < kRepeats; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() < best) best = elapsed.count();
+    }
+    return best;
+}
+
+bool sameMesh(const Mesh& a, const Mesh& b) {
+    auto equal = [](auto lhs, auto rhs) {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    };
+    return equal(a.GetX(), b.GetX()) && equal(a.GetY(), b.GetY()) &&
+           equal(a.GetZ(), b.GetZ()) && equal(a.GetEdgeIndices(), b.GetEdgeIndices());
+}
+
+void benchFile(const std::string& path) {
+    size_t bytes = std::filesystem::file_size(path);
+    NormalizationParameters params;
+
+    // Только разбор из памяти (без построения Mesh)
+    MappedFile file;
+    file.Open(path);
+    ObjParser parser;
+    ObjParseResult parsed;
+    double parseSeconds = bestSeconds([&]() {
+        parsed.Clear();
+        parser.Parse(file.GetData(), file.GetSize(), parsed);
+    });
+
+    FileReader streamReader;
+    streamReader.SetParseMode(FileReader::ParseMode::kStream);
+    streamReader.SetCacheEnabled(false);
+    FacadeOperationResult streamResult(false, "");
+    double streamSeconds = bestSeconds([&]() { streamResult = streamReader.ReadMesh(path, params); });
+
+    FileReader mappedReader;
+    mappedReader.SetParseMode(FileReader::ParseMode::kMapped);
+    mappedReader.SetCacheEnabled(false);
+    FacadeOperationResult mappedResult(false, "");
+    double mappedSeconds = bestSeconds([&]() { mappedResult = mappedReader.ReadMesh(path, params); });
+
+    // Кэш во временном каталоге: первый вызов пишет его, повторы - попадания
+    FileReader cachedReader;
+    cachedReader.SetCacheEnabled(true);
+    cachedReader.SetCacheDirectory(
+        (std::filesystem::temp_directory_path() / "3DViewer_bench_cache").string());
+    FacadeOperationResult cachedResult = cachedReader.ReadMesh(path, params);
+    double cachedSeconds = bestSeconds([&]() { cachedResult = cachedReader.ReadMesh(path, params); });
+
+    std::printf("%s (%.1f MB)\n", path.c_str(), megabytes(bytes));
+    std::printf("  ObjParser::Parse      %8.1f MB/s\n", megabytes(bytes) / parseSeconds);
+    std::printf("  ReadMesh kStream      %8.1f MB/s\n", megabytes(bytes) / streamSeconds);
+    std::printf("  ReadMesh kMapped      %8.1f MB/s  (x%.1f)\n", megabytes(bytes) / mappedSeconds,
+                streamSeconds / mappedSeconds);
+    std::printf("  ReadMesh cache hit    %8.3f ms      (x%.0f)\n", cachedSeconds * 1e3,
+                streamSeconds / cachedSeconds);
+    if (cachedResult.IsSuccess() && !sameMesh(cachedResult.GetMesh(), mappedResult.GetMesh())) {
+        std::printf("  MISMATCH between cached and parsed results\n");
+    }
+    if (streamResult.IsSuccess() != mappedResult.IsSuccess() ||
+        (streamResult.IsSuccess() && !sameMesh(streamResult.GetMesh(), mappedResult.GetMesh()))) {
+        std::printf("  MISMATCH between kStream and kMapped results\n");
+    }
+}
+
+}  // namespace
+
+}  // namespace s21
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::printf("Usage: %s model.obj [model.obj ...]\n", argv[0]);
+        return 1;
+    }
+    for (int i = 1; i < argc; ++i) s21::benchFile(argv[i]);
+    return 0;
+}
@@ -0,0 +1,131 @@
+// BENCH_RASTERIZER.CPP - QPainter против многопоточного SoftwareRasterizer
+//
+// ЗАЧЕМ НУЖЕН:
+// Сравнивает время кадра большого каркаса (по умолчанию ~5M ребер):
+// 1. QtSceneDrawer - пакетные drawLines/drawPoints в одном потоке
+// 2. SoftwareSceneDrawer на ThreadPool из 1, 2, 4, ... потоков
+//    (проекция кэширована, замеряется растеризация и вывод кадра)
+// Проверяет, что буфер кадра побитово совпадает при любом числе потоков
+// (с тестом глубины и без). Рисование идет в QImage, окно не нужно.
+//
+// ЗАПУСК:
+// ./bench_rasterizer [gridSide]
+// Код возврата 1 - кадры при разном числе потоков различаются.
+//
+// Все в namespace s21
+
+#include <QGuiApplication>
+#include <QImage>
+#include <QPainter>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "../model/parallel.h"
+#include "../view/rendering.h"
+
+namespace s21 {
+
+namespace {
+
+constexpr int kFrames = 5;
+constexpr int kWidth = 1280;
+constexpr int kHeight = 960;
+
+Mesh gridMesh(size_t side) {
+    std::vector<float> x, y, z;
+    x.reserve(side * side);
+    y.reserve(side * side);
+    z.reserve(side * side);
+    for (size_t i = 0; i < side; ++i) {
+        for (size_t j = 0; j < side; ++j) {
+            x.push_back(float(i) / side - 0.5f);
+            y.push_back(float(j) / side - 0.5f);
+            z.push_back(float((i * 7 + j * 13) % 17) / 170.0f);
+        }
+    }
+    std::vector<uint32_t> edges;
+    edges.reserve((side - 1) * (side - 1) * 6);
+    for (size_t i = 0; i + 1 < side; ++i) {
+        for (size_t j = 0; j + 1 < side; ++j) {
+            uint32_t a = uint32_t(i * side + j);
+            uint32_t b = a + 1, c = a + uint32_t(side), d = c + 1;
+            const uint32_t pairs[6] = {a, b, a, c, a, d};
+            edges.insert(edges.end(), pairs, pairs + 6);
+        }
+    }
+    Mesh mesh;
+    mesh.SetPositions(std::move(x), std::move(y), std::move(z));
+    mesh.SetEdges(std::move(edges));
+    return mesh;
+}
+
+// Среднее время кадра (первый кадр с проекцией не учитывается)
+template <typename Drawer>
+double frameMilliseconds(Drawer& drawer, QPainter& painter, const Mesh& mesh,
+                         const TransformMatrix& matrix, const DrawSettings& settings) {
+    drawer.DrawMesh(painter, mesh, matrix, settings);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kFrames; ++i) drawer.DrawMesh(painter, mesh, matrix, settings);
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / kFrames;
+}
+
+std::vector<unsigned> threadCounts() {
+    std::vector<unsigned> counts;
+    unsigned maximum = GetWorkerCount();
+    for (unsigned n = 1; n < maximum; n *= 2) counts.push_back(n);
+    counts.push_back(maximum);
+    return counts;
+}
+
+}  // namespace
+
+}  // namespace s21
+
+int main(int argc, char* argv[]) {
+    QGuiApplication app(argc, argv);
+    size_t side = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1292;  // ~5M ребер
+
+    s21::Mesh mesh = s21::gridMesh(side);
+    s21::TransformMatrix matrix = s21::TransformMatrixBuilder::CreateRotationMatrix(0.3, 0.2, 0.1);
+    s21::DrawSettings settings;
+    settings.vertex_size = 2.0;
+
+    QImage image(s21::kWidth, s21::kHeight, QImage::Format_ARGB32_Premultiplied);
+    QPainter painter(&image);
+    std::printf("%zu vertices, %zu edges, %dx%d\n", mesh.GetVertexCount(), mesh.GetEdgeCount(),
+                s21::kWidth, s21::kHeight);
+
+    s21::QtSceneDrawer qtDrawer;
+    double qtTime = s21::frameMilliseconds(qtDrawer, painter, mesh, matrix, settings);
+    std::printf("  QtSceneDrawer                  %10.1f ms\n", qtTime);
+
+    bool identical = true;
+    for (bool depth : {false, true}) {
+        std::vector<uint32_t> reference;
+        for (unsigned threads : s21::threadCounts()) {
+            s21::ThreadPool pool(threads);
+            s21::SoftwareSceneDrawer drawer(pool);
+            drawer.SetDepthTest(depth);
+            double time = s21::frameMilliseconds(drawer, painter, mesh, matrix, settings);
+
+            const s21::SoftwareRasterizer& raster = drawer.GetRasterizer();
+            size_t pixels = size_t(raster.GetWidth()) * raster.GetHeight();
+            bool same = true;
+            if (reference.empty()) {
+                reference.assign(raster.GetPixels(), raster.GetPixels() + pixels);
+            } else {
+                same = std::memcmp(reference.data(), raster.GetPixels(),
+                                   pixels * sizeof(uint32_t)) == 0;
+                identical = identical && same;
+            }
+            std::printf("  Software%s %2u threads %10.1f ms  (x%.1f)%s\n",
+                        depth ? " depth" : "      ", threads, time, qtTime / time,
+                        same ? "" : "  MISMATCH");
+        }
+    }
+    return identical ? 0 : 1;
+}
@@ -0,0 +1,138 @@
+// BENCH_RENDERING.CPP - Замер отрисовки каркаса через QPainter
+//
+// ЗАЧЕМ НУЖЕН:
+// Сравнивает время кадра для большого каркаса (по умолчанию ~5M ребер):
+// 1. Поштучная отрисовка: проекция вершин на каждом ребре, drawLine на ребро,
+//    drawPoint на вершину (исходная схема QtSceneDrawer)
+// 2. QtSceneDrawer: кэш проекции + пакетные drawLines/drawPoints,
+//    первый кадр (проекция) и повторный кадр (кэш действителен)
+// 3. Приближение x kZoom: QtSceneDrawer без индекса и с EdgeGrid (рисуются
+//    только ячейки в кадре), плюс модель целиком в маленьком окне
+//    (ячейки меньше пикселя - точки)
+// Рисование идет в QImage, окно не нужно.
+//
+// ЗАПУСК:
+// ./bench_rendering [gridSide]
+// Сетка gridSide x gridSide вершин, ребра по сторонам и диагоналям квадратов.
+//
+// Все в namespace s21
+
+#include <QGuiApplication>
+#include <QImage>
+#include <QPainter>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../model/edge_grid.h"
+#include "../view/rendering.h"
+
+namespace s21 {
+
+namespace {
+
+Mesh gridMesh(size_t side) {
+    std::vector<float> x, y, z;
+    x.reserve(side * side);
+    y.reserve(side * side);
+    z.reserve(side * side);
+    for (size_t i = 0; i < side; ++i) {
+        for (size_t j = 0; j < side; ++j) {
+            x.push_back(float(i) / side - 0.5f);
+            y.push_back(float(j) / side - 0.5f);
+            z.push_back(float((i * 7 + j * 13) % 17) / 170.0f);
+        }
+    }
+    std::vector<uint32_t> edges;
+    edges.reserve((side - 1) * (side - 1) * 6);
+    for (size_t i = 0; i + 1 < side; ++i) {
+        for (size_t j = 0; j + 1 < side; ++j) {
+            uint32_t a = uint32_t(i * side + j);
+            uint32_t b = a + 1, c = a + uint32_t(side), d = c + 1;
+            const uint32_t pairs[6] = {a, b, a, c, a, d};
+            edges.insert(edges.end(), pairs, pairs + 6);
+        }
+    }
+    Mesh mesh;
+    mesh.SetPositions(std::move(x), std::move(y), std::move(z));
+    mesh.SetEdges(std::move(edges));
+    return mesh;
+}
+
+// Поштучная отрисовка для сравнения
+void drawPerElement(QPainter& painter, const Mesh& mesh, const Mat4& matrix,
+                    const DrawSettings& settings) {
+    double half = std::min(painter.device()->width(), painter.device()->height()) * 0.5;
+    auto project = [&](uint32_t i) {
+        Vec3 p = matrix.Transform(Vec3{mesh.GetX()[i], mesh.GetY()[i], mesh.GetZ()[i]});
+        return QPointF(painter.device()->width() * 0.5 + p.x * half,
+                       painter.device()->height() * 0.5 - p.y * half);
+    };
+    painter.setPen(QPen(settings.line_color, settings.line_width));
+    std::span<const uint32_t> edges = mesh.GetEdgeIndices();
+    for (size_t e = 0; e < edges.size(); e += 2) {
+        painter.drawLine(project(edges[e]), project(edges[e + 1]));
+    }
+    painter.setPen(QPen(settings.vertex_color, settings.vertex_size));
+    for (size_t v = 0; v < mesh.GetVertexCount(); ++v) painter.drawPoint(project(uint32_t(v)));
+}
+
+constexpr double kZoom = 20.0;
+
+template <typename Fn>
+double milliseconds(Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+}  // namespace
+
+}  // namespace s21
+
+int main(int argc, char* argv[]) {
+    QGuiApplication app(argc, argv);
+    size_t side = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1292;  // ~5M ребер
+
+    s21::Mesh mesh = s21::gridMesh(side);
+    s21::TransformMatrix matrix = s21::TransformMatrixBuilder::CreateRotationMatrix(0.3, 0.2, 0.1);
+    s21::DrawSettings settings;
+    settings.vertex_size = 2.0;
+
+    QImage image(1280, 960, QImage::Format_ARGB32_Premultiplied);
+    QPainter painter(&image);
+
+    std::printf("%zu vertices, %zu edges, 1280x960\n", mesh.GetVertexCount(), mesh.GetEdgeCount());
+    double perElement = s21::milliseconds([&]() {
+        s21::drawPerElement(painter, mesh, matrix.GetMat4(), settings);
+    });
+    std::printf("  drawLine/drawPoint per element %10.1f ms\n", perElement);
+
+    s21::QtSceneDrawer drawer;
+    double first = s21::milliseconds([&]() { drawer.DrawMesh(painter, mesh, matrix, settings); });
+    double repeated = s21::milliseconds([&]() { drawer.DrawMesh(painter, mesh, matrix, settings); });
+    std::printf("  QtSceneDrawer first frame      %10.1f ms  (x%.1f)\n", first, perElement / first);
+    std::printf("  QtSceneDrawer cached frame     %10.1f ms  (x%.1f)\n", repeated, perElement / repeated);
+
+    s21::EdgeGrid grid;
+    double build = s21::milliseconds([&]() { grid.Build(mesh); });
+    std::printf("EdgeGrid: %zu cells, built in %.1f ms\n", grid.GetCells().size(), build);
+
+    s21::TransformMatrix zoomed =
+        s21::TransformMatrixBuilder::CreateScaleMatrix(s21::kZoom, s21::kZoom, s21::kZoom).Multiply(matrix);
+    s21::QtSceneDrawer culled;
+    culled.SetEdgeGrid(&grid);
+    double full = s21::milliseconds([&]() { drawer.DrawMesh(painter, mesh, zoomed, settings); });
+    double visible = s21::milliseconds([&]() { culled.DrawMesh(painter, mesh, zoomed, settings); });
+    std::printf("  zoom x%.0f, without index       %10.1f ms\n", s21::kZoom, full);
+    std::printf("  zoom x%.0f, EdgeGrid culling    %10.1f ms  (x%.1f)\n", s21::kZoom, visible, full / visible);
+
+    QImage small(64, 64, QImage::Format_ARGB32_Premultiplied);
+    QPainter smallPainter(&small);
+    double tiny = s21::milliseconds([&]() { culled.DrawMesh(smallPainter, mesh, matrix, settings); });
+    std::printf("  64x64, sub-pixel cells          %10.1f ms\n", tiny);
+    return 0;
+}
@@ -0,0 +1,536 @@
+// BENCH_SUITE.CPP - Набор микробенчмарков слоя модели и отрисовки с JSON отчетом
+//
+// ЗАЧЕМ НУЖЕН:
+// Остальные бенчмарки печатают текст для человека и требуют внешних файлов.
+// Этот набор сам генерирует модели (ObjGenerator), замеряет каждый этап
+// загрузки и отрисовки и пишет машиночитаемый JSON - по нему между
+// сборками ищутся регрессии. Формат JSON совпадает с Google Benchmark
+// (context + benchmarks[] с real_time/cpu_time/time_unit), поэтому
+// подходят его инструменты сравнения (compare.py).
+//
+// ЧТО ЗАМЕРЯЕТСЯ (для каждой формы и размера модели):
+// - parse_vertex - строки "v x y z": разбор трех чисел (ParseObjDouble)
+// - parse_face - строки "f ...": разбор индексов (ParseObjIndex)
+// - obj_parser - ObjParser::Parse всего файла из памяти (параллельно)
+// - read_mesh/mapped, read_mesh/stream - FileReader::ReadMesh без кэша
+// - edge_builder - уникальные ребра из граней (как createEdgesFromFaces)
+// - mesh_reorder - MeshReorderer на копии Mesh в порядке файла (копия
+//   входит в замер); в stdout - ускорение прохода по концам ребер
+// - normalize - границы + одна матрица центрирования и масштаба (как normalizeMesh)
+// - mesh_transform - Mesh::Transform
+// - draw_qpainter, draw_qpainter_cached, draw_software - QtSceneDrawer
+//   (с проекцией и по кэшу) и SoftwareSceneDrawer в QImage kImageWidth x kImageHeight
+// - draw_solid - SolidStrategy (проекция, освещение граней, развертка
+//   треугольников); items - число треугольников
+// - draw_points - PointCloudStrategy (проекция прямо в буфер глубины,
+//   разрешение кадра); items - число точек. Для формы cloud (только "v")
+//   это основной путь отрисовки
+// - mesh_compact/16, mesh_compact/21 - Mesh::SetVertexPrecision (квантование
+//   координат и кодирование ребер, копия входит в замер); в stdout - байт
+//   на вершину и ребро и наибольшая ошибка координаты
+// - draw_software_q16, draw_points_q16 - те же стратегии для сжатого
+//   mesh'а (16 бит): цена раскодирования в кадре
+//
+// КАК РАБОТАЕТ:
+// 1. Файл "<tmp>/s21_bench_<форма>_<вершины>.obj" генерируется один раз
+//    (генератор детерминирован, существующий файл используется повторно)
+// 2. Случай сначала выполняется один раз (прогрев), затем повторяется,
+//    пока суммарное время не достигнет --min-time; real_time и cpu_time -
+//    среднее на итерацию
+// 3. Данные случая (разобранный файл, Mesh) готовятся вне замера
+//
+// ЗАПУСК:
+// ./bench_suite [--json out.json] [--sizes 1000,100000,1000000]
+//               [--shapes sphere,grid,soup,cloud] [--filter substring]
+//               [--min-time seconds] [--tmp dir]
+// ./bench_suite --generate <sphere|grid|soup|cloud> <vertices> <out.obj>
+// Для 50M вершин: --sizes 50000000 (файл ~2 ГБ во временном каталоге)
+//
+// Все в namespace s21
+
+#include <QGuiApplication>
+#include <QImage>
+#include <QPainter>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "../model/io.h"
+#include "../model/mapped_file.h"
+#include "../model/obj_parser.h"
+#include "../model/parallel.h"
+#include "../view/rendering.h"
+#include "obj_generator.h"
+
+namespace s21 {
+
+namespace {
+
+constexpr int kImageWidth = 1024;
+constexpr int kImageHeight = 768;
+
+struct SuiteOptions {
+    std::vector<size_t> sizes{1000, 100000, 1000000};
+    std::vector<ObjShape> shapes{ObjShape::kSphere, ObjShape::kGrid, ObjShape::kSoup, ObjShape::kCloud};
+    std::string json_path;
+    std::string filter;
+    std::string tmp_dir = std::filesystem::temp_directory_path().string();
+    double min_seconds = 0.5;
+};
+
+struct BenchResult {
+    std::string name;
+    size_t iterations = 0;
+    double real_ms = 0.0;   // На итерацию
+    double cpu_ms = 0.0;    // Процессорное время всех потоков на итерацию
+    double items = 0.0;     // Элементов за итерацию (0 - не выводится)
+    double bytes = 0.0;
+};
+
+// Запрещает компилятору выбросить вычисление
+template <typename T>
+void keep(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+class Runner {
+public:
+    explicit Runner(const SuiteOptions& options) : options_(options) {}
+
+    // items/bytes - объем работы одной итерации (для *_per_second)
+    void Run(const std::string& name, double items, double bytes, const std::function<void()>& body) {
+        if (!options_.filter.empty() && name.find(options_.filter) == std::string::npos) return;
+        body();  // Прогрев: кэши, буферы, пул потоков
+
+        BenchResult result{name, 0, 0.0, 0.0, items, bytes};
+        auto start = std::chrono::steady_clock::now();
+        std::clock_t cpuStart = std::clock();
+        double elapsed = 0.0;
+        do {
+            body();
+            ++result.iterations;
+            elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        } while (elapsed < options_.min_seconds);
+        double cpu = double(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+        result.real_ms = elapsed * 1e3 / result.iterations;
+        result.cpu_ms = cpu * 1e3 / result.iterations;
+
+        std::printf("%-44s %8zu it %12.3f ms", name.c_str(), result.iterations, result.real_ms);
+        if (items > 0.0) std::printf("  %10.2f M items/s", items / result.real_ms / 1e3);
+        if (bytes > 0.0) std::printf("  %8.1f MB/s", bytes / result.real_ms / 1e3);
+        std::printf("\n");
+        results_.push_back(std::move(result));
+    }
+
+    const std::vector<BenchResult>& GetResults() const { return results_; }
+
+private:
+    const SuiteOptions& options_;
+    std::vector<BenchResult> results_;
+};
+
+// ====== Подготовка данных ======
+
+std::string benchFilePath(const SuiteOptions& options, ObjShape shape, size_t vertices) {
+    return (std::filesystem::path(options.tmp_dir) /
+            ("s21_bench_" + std::string(GetObjShapeName(shape)) + "_" + std::to_string(vertices) + ".obj"))
+        .string();
+}
+
+bool ensureFile(const std::string& path, ObjShape shape, size_t vertices) {
+    std::error_code ec;
+    if (std::filesystem::exists(path, ec)) return true;
+    std::string partial = path + ".tmp";  // Без полузаписанных файлов при прерывании
+    if (!ObjGenerator::WriteObjFile(partial, shape, vertices)) return false;
+    std::filesystem::rename(partial, path, ec);
+    return !ec;
+}
+
+// Строки файла с префиксом "v " или "f " (без перевода строки)
+std::vector<std::string_view> collectLines(const MappedFile& file, char kind) {
+    std::vector<std::string_view> lines;
+    const char* data = file.GetData();
+    const char* end = data + file.GetSize();
+    while (data < end) {
+        const char* eol = static_cast<const char*>(std::memchr(data, '\n', size_t(end - data)));
+        if (!eol) eol = end;
+        if (eol - data > 2 && data[0] == kind && data[1] == ' ') lines.emplace_back(data, size_t(eol - data));
+        data = eol + 1;
+    }
+    return lines;
+}
+
+double totalBytes(const std::vector<std::string_view>& lines) {
+    double bytes = 0.0;
+    for (std::string_view line : lines) bytes += double(line.size() + 1);
+    return bytes;
+}
+
+// Токены строки после префикса: fn(begin, end) на каждый
+template <typename Fn>
+void forEachToken(std::string_view line, Fn&& fn) {
+    const char* p = line.data() + 2;
+    const char* end = line.data() + line.size();
+    while (p < end) {
+        while (p < end && *p == ' ') ++p;
+        const char* token = p;
+        while (p < end && *p != ' ') ++p;
+        if (p > token) fn(token, p);
+    }
+}
+
+// ====== Случаи ======
+
+void benchTokens(Runner& runner, const std::string& suffix, const MappedFile& file) {
+    std::vector<std::string_view> vertices = collectLines(file, 'v');
+    runner.Run("parse_vertex/" + suffix, double(vertices.size()), totalBytes(vertices), [&]() {
+        double sum = 0.0;
+        for (std::string_view line : vertices) {
+            forEachToken(line, [&](const char* begin, const char* end) {
+                double value = 0.0;
+                ParseObjDouble(begin, end, value);
+                sum += value;
+            });
+        }
+        keep(sum);
+    });
+
+    std::vector<std::string_view> faces = collectLines(file, 'f');
+    runner.Run("parse_face/" + suffix, double(faces.size()), totalBytes(faces), [&]() {
+        long long sum = 0;
+        for (std::string_view line : faces) {
+            forEachToken(line, [&](const char* begin, const char* end) {
+                int index = 0;
+                ParseObjIndex(begin, end, index);
+                sum += index;
+            });
+        }
+        keep(sum);
+    });
+}
+
+void benchLoading(Runner& runner, const std::string& suffix, const std::string& path,
+                  const MappedFile& file, Mesh& mesh) {
+    const double bytes = double(file.GetSize());
+    ObjParser parser;
+    ObjParseResult parsed;
+    runner.Run("obj_parser/" + suffix, 0.0, bytes, [&]() {
+        parsed.Clear();
+        keep(parser.Parse(file.GetData(), file.GetSize(), parsed));
+    });
+
+    for (auto [mode, name] : {std::pair{FileReader::ParseMode::kMapped, "mapped"},
+                              std::pair{FileReader::ParseMode::kStream, "stream"}}) {
+        FileReader reader;
+        reader.SetParseMode(mode);
+        reader.SetCacheEnabled(false);
+        FacadeOperationResult result = reader.ReadMesh(path, NormalizationParameters());
+        if (result.IsError()) {
+            std::printf("read_mesh/%s/%s: %s\n", name, suffix.c_str(), result.GetErrorMessage().c_str());
+            continue;
+        }
+        const double vertices = double(result.GetMesh().GetVertexCount());
+        runner.Run(std::string("read_mesh/") + name + "/" + suffix, vertices, bytes, [&]() {
+            FacadeOperationResult loaded = reader.ReadMesh(path, NormalizationParameters());
+            keep(loaded.GetMesh().GetEdgeCount());
+        });
+        if (mesh.GetVertexCount() == 0) mesh = result.TakeMesh();
+    }
+
+    parsed.Clear();
+    parser.Parse(file.GetData(), file.GetSize(), parsed);
+    EdgeBuilder builder;
+    runner.Run("edge_builder/" + suffix, double(parsed.GetFaceCount()), 0.0, [&]() {
+        builder.Begin(parsed.face_indices.size());
+        for (size_t f = 0; f < parsed.GetFaceCount(); ++f) {
+            builder.AddFace(parsed.face_indices.data() + parsed.face_offsets[f],
+                            parsed.face_offsets[f + 1] - parsed.face_offsets[f]);
+        }
+        keep(builder.TakeEdges().size());
+    });
+}
+
+void benchReorder(Runner& runner, const std::string& suffix, const std::string& path) {
+    FileReader reader;
+    reader.SetCacheEnabled(false);
+    reader.SetVertexOrder(VertexOrder::kFile);
+    FacadeOperationResult result = reader.ReadMesh(path, NormalizationParameters());
+    if (result.IsError()) return;
+    const Mesh fileOrder = result.TakeMesh();
+
+    MeshReorderer reorderer;
+    ReorderStats stats;
+    runner.Run("mesh_reorder/" + suffix, double(fileOrder.GetVertexCount()), 0.0, [&]() {
+        Mesh mesh = fileOrder;
+        stats = reorderer.Reorder(mesh);
+    });
+    if (stats.applied) {
+        std::printf("  edge sweep %.2f -> %.2f ms (x%.2f), mean edge span %.0f -> %.0f\n",
+                    stats.sweep_before_ms, stats.sweep_after_ms, stats.GetSpeedup(),
+                    stats.mean_span_before, stats.mean_span_after);
+    }
+}
+
+void benchTransforms(Runner& runner, const std::string& suffix, Mesh& mesh) {
+    const double vertices = double(mesh.GetVertexCount());
+    runner.Run("normalize/" + suffix, vertices, 0.0, [&]() {
+        BoundingBox bounds = mesh.ComputeBounds();
+        double extent = std::max({bounds.max.x - bounds.min.x, bounds.max.y - bounds.min.y,
+                                  bounds.max.z - bounds.min.z});
+        double scale = extent > 0.0 ? 1.0 / extent : 1.0;
+        mesh.Transform(TransformMatrix(Mat4::Scale(scale, scale, scale) *
+                                       Mat4::Translation(-(bounds.min.x + bounds.max.x) * 0.5,
+                                                         -(bounds.min.y + bounds.max.y) * 0.5,
+                                                         -(bounds.min.z + bounds.max.z) * 0.5)));
+    });
+
+    TransformMatrix rotation = TransformMatrixBuilder::CreateRotationMatrix(0.01, 0.02, 0.03);
+    runner.Run("mesh_transform/" + suffix, vertices, 0.0, [&]() { mesh.Transform(rotation); });
+}
+
+void benchDrawers(Runner& runner, const std::string& suffix, const Mesh& mesh) {
+    QImage image(kImageWidth, kImageHeight, QImage::Format_ARGB32_Premultiplied);
+    QPainter painter(&image);
+    TransformMatrix matrix = TransformMatrixBuilder::CreateRotationMatrix(0.3, 0.2, 0.1);
+    DrawSettings settings;
+    settings.vertex_size = 2.0;
+    const double edges = double(mesh.GetEdgeCount());
+
+    QtSceneDrawer qt;
+    runner.Run("draw_qpainter/" + suffix, edges, 0.0, [&]() {
+        qt.InvalidateCache();  // Каждый кадр с проекцией вершин
+        qt.DrawMesh(painter, mesh, matrix, settings);
+    });
+    runner.Run("draw_qpainter_cached/" + suffix, edges, 0.0,
+               [&]() { qt.DrawMesh(painter, mesh, matrix, settings); });
+
+    SoftwareSceneDrawer software;
+    runner.Run("draw_software/" + suffix, edges, 0.0, [&]() {
+        software.InvalidateCache();
+        software.DrawMesh(painter, mesh, matrix, settings);
+    });
+
+    SolidStrategy solid;
+    settings.vertex_size = 0.0;
+    runner.Run("draw_solid/" + suffix, double(mesh.GetTriangleCount()), 0.0, [&]() {
+        solid.InvalidateCache();  // Каждый кадр с проекцией и освещением граней
+        solid.DrawMesh(painter, mesh, matrix, settings);
+    });
+
+    PointCloudStrategy points;
+    runner.Run("draw_points/" + suffix, double(mesh.GetVertexCount()), 0.0, [&]() {
+        points.InvalidateCache();  // Иначе повтор кадра - только вывод готового изображения
+        points.DrawMesh(painter, mesh, matrix, settings);
+    });
+}
+
+void benchCompact(Runner& runner, const std::string& suffix, const Mesh& mesh) {
+    const double vertices = double(mesh.GetVertexCount());
+    Mesh compact;
+    for (auto [precision, name] : {std::pair{VertexPrecision::kBits21, "21"},
+                                   std::pair{VertexPrecision::kBits16, "16"}}) {
+        runner.Run(std::string("mesh_compact/") + name + "/" + suffix, vertices, 0.0, [&]() {
+            compact = mesh;
+            compact.SetVertexPrecision(precision);
+        });
+        if (!compact.IsCompact()) {  // Случай отфильтрован
+            compact = mesh;
+            compact.SetVertexPrecision(precision);
+        }
+        const CompactGeometry& geometry = *compact.GetCompact();
+        std::printf("  %s-bit: %.2f bytes/vertex (float 12), max error %.2g", name,
+                    double(geometry.positions.GetMemoryBytes()) / std::max(vertices, 1.0),
+                    double(geometry.positions.GetMaxError()));
+        if (mesh.GetEdgeCount() > 0) {
+            std::printf(", %.2f bytes/edge (float 8)",
+                        double(geometry.edges.GetMemoryBytes()) / double(mesh.GetEdgeCount()));
+        }
+        std::printf("\n");
+    }
+
+    // compact - 16 бит (последний в списке)
+    QImage image(kImageWidth, kImageHeight, QImage::Format_ARGB32_Premultiplied);
+    QPainter painter(&image);
+    TransformMatrix matrix = TransformMatrixBuilder::CreateRotationMatrix(0.3, 0.2, 0.1);
+    DrawSettings settings;
+    settings.vertex_size = 2.0;
+    SoftwareSceneDrawer software;
+    runner.Run("draw_software_q16/" + suffix, double(mesh.GetEdgeCount()), 0.0, [&]() {
+        software.InvalidateCache();
+        software.DrawMesh(painter, compact, matrix, settings);
+    });
+    PointCloudStrategy points;
+    runner.Run("draw_points_q16/" + suffix, vertices, 0.0, [&]() {
+        points.InvalidateCache();
+        points.DrawMesh(painter, compact, matrix, settings);
+    });
+}
+
+bool benchModel(Runner& runner, const SuiteOptions& options, ObjShape shape, size_t vertices) {
+    std::string path = benchFilePath(options, shape, vertices);
+    if (!ensureFile(path, shape, vertices)) {
+        std::printf("cannot write %s\n", path.c_str());
+        return false;
+    }
+    MappedFile file;
+    if (!file.Open(path)) {
+        std::printf("cannot map %s\n", path.c_str());
+        return false;
+    }
+    std::string suffix = std::string(GetObjShapeName(shape)) + "/" + std::to_string(vertices);
+    Mesh mesh;
+    benchTokens(runner, suffix, file);
+    benchLoading(runner, suffix, path, file, mesh);
+    if (mesh.GetVertexCount() == 0) return false;
+    benchReorder(runner, suffix, path);
+    benchDrawers(runner, suffix, mesh);      // Нормализованный mesh из ReadMesh
+    benchCompact(runner, suffix, mesh);
+    benchTransforms(runner, suffix, mesh);   // Меняет mesh - последним
+    return true;
+}
+
+// ====== JSON (схема Google Benchmark) ======
+
+std::string jsonString(std::string_view text) {
+    std::string out = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out + "\"";
+}
+
+bool writeJson(const std::string& path, const std::vector<BenchResult>& results) {
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> file(std::fopen(path.c_str(), "w"), &std::fclose);
+    if (!file) return false;
+    std::time_t now = std::time(nullptr);
+    char date[32];
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+    std::FILE* out = file.get();
+    std::fprintf(out, "{\n  \"context\": {\n");
+    std::fprintf(out, "    \"date\": %s,\n", jsonString(date).c_str());
+    std::fprintf(out, "    \"executable\": \"bench_suite\",\n");
+    std::fprintf(out, "    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+    std::fprintf(out, "    \"num_workers\": %u,\n", GetWorkerCount());
+#ifdef NDEBUG
+    std::fprintf(out, "    \"library_build_type\": \"release\"\n");
+#else
+    std::fprintf(out, "    \"library_build_type\": \"debug\"\n");
+#endif
+    std::fprintf(out, "  },\n  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        std::fprintf(out, "    {\n      \"name\": %s,\n      \"run_name\": %s,\n", jsonString(r.name).c_str(),
+                     jsonString(r.name).c_str());
+        std::fprintf(out, "      \"run_type\": \"iteration\",\n      \"iterations\": %zu,\n", r.iterations);
+        std::fprintf(out, "      \"real_time\": %.6f,\n      \"cpu_time\": %.6f,\n", r.real_ms, r.cpu_ms);
+        std::fprintf(out, "      \"time_unit\": \"ms\"");
+        if (r.items > 0.0) std::fprintf(out, ",\n      \"items_per_second\": %.6e", r.items / r.real_ms * 1e3);
+        if (r.bytes > 0.0) std::fprintf(out, ",\n      \"bytes_per_second\": %.6e", r.bytes / r.real_ms * 1e3);
+        std::fprintf(out, "\n    }%s\n", i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(out, "  ]\n}\n");
+    return std::fclose(file.release()) == 0;
+}
+
+// ====== Аргументы ======
+
+template <typename T, typename Parse>
+bool parseList(const char* text, std::vector<T>& out, Parse&& parse) {
+    out.clear();
+    std::string_view rest(text);
+    while (!rest.empty()) {
+        size_t comma = rest.find(',');
+        T value;
+        if (!parse(rest.substr(0, comma), value)) return false;
+        out.push_back(value);
+        rest = comma == std::string_view::npos ? std::string_view() : rest.substr(comma + 1);
+    }
+    return !out.empty();
+}
+
+bool parseCount(std::string_view text, size_t& value) {
+    char* end = nullptr;
+    std::string copy(text);
+    value = std::strtoull(copy.c_str(), &end, 10);
+    return !copy.empty() && *end == '\0' && value > 0;
+}
+
+bool parseOptions(int argc, char* argv[], SuiteOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (!value) return false;
+        if (arg == "--json") {
+            options.json_path = value;
+        } else if (arg == "--sizes") {
+            if (!parseList(value, options.sizes, parseCount)) return false;
+        } else if (arg == "--shapes") {
+            if (!parseList(value, options.shapes, ParseObjShape)) return false;
+        } else if (arg == "--filter") {
+            options.filter = value;
+        } else if (arg == "--min-time") {
+            options.min_seconds = std::atof(value);
+        } else if (arg == "--tmp") {
+            options.tmp_dir = value;
+        } else {
+            return false;
+        }
+        ++i;
+    }
+    return true;
+}
+
+int generate(int argc, char* argv[]) {
+    ObjShape shape;
+    size_t vertices = 0;
+    if (argc != 5 || !ParseObjShape(argv[2], shape) || !parseCount(argv[3], vertices)) {
+        std::printf("Usage: %s --generate <sphere|grid|soup|cloud> <vertices> <out.obj>\n", argv[0]);
+        return 1;
+    }
+    if (!ObjGenerator::WriteObjFile(argv[4], shape, vertices)) {
+        std::printf("cannot write %s\n", argv[4]);
+        return 1;
+    }
+    return 0;
+}
+
+}  // namespace
+
+}  // namespace s21
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::strcmp(argv[1], "--generate") == 0) return s21::generate(argc, argv);
+
+    s21::SuiteOptions options;
+    if (!s21::parseOptions(argc, argv, options)) {
+        std::printf("Usage: %s [--json out.json] [--sizes n,n,...] [--shapes sphere,grid,soup,cloud]\n"
+                    "          [--filter substring] [--min-time seconds] [--tmp dir]\n"
+                    "       %s --generate <sphere|grid|soup|cloud> <vertices> <out.obj>\n",
+                    argv[0], argv[0]);
+        return 1;
+    }
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) qputenv("QT_QPA_PLATFORM", "offscreen");
+    QGuiApplication app(argc, argv);
+
+    s21::Runner runner(options);
+    bool ok = true;
+    for (s21::ObjShape shape : options.shapes) {
+        for (size_t vertices : options.sizes) ok = s21::benchModel(runner, options, shape, vertices) && ok;
+    }
+    if (!options.json_path.empty() && !s21::writeJson(options.json_path, runner.GetResults())) {
+        std::printf("cannot write %s\n", options.json_path.c_str());
+        return 1;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,235 @@
+// BENCH_TRANSFORM.CPP - Сверка и замер ядер TransformPositions, ProjectPositionsWith
+// и ComputePositionBounds
+//
+// ЗАЧЕМ НУЖЕН:
+// 1. Проверяет, что SSE2/AVX2 ядра побитово совпадают со скалярным
+//    (разные размеры массивов, включая хвосты, разные матрицы); для проекции -
+//    матрица с перспективной нижней строкой
+// 2. Проверяет, что SIMD и параллельные границы совпадают с std::minmax_element
+// 3. Замеряет время трансформации и границ 10M вершин каждым ядром и
+//    параллельно (бюджет интерактива - один кадр, 16 мс)
+//
+// ЗАПУСК:
+// ./bench_transform [vertexCount]
+// Код возврата 1, если хотя бы одно ядро расходится со скалярным.
+//
+// Все в namespace s21
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "../model/transform_kernel.h"
+
+namespace s21 {
+
+namespace {
+
+const KernelIsa kAllIsas[] = {KernelIsa::kScalar, KernelIsa::kSse2, KernelIsa::kAvx2};
+
+struct Positions {
+    std::vector<float> x, y, z;
+};
+
+Positions randomPositions(size_t count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-1000.0f, 1000.0f);
+    Positions p;
+    p.x.resize(count);
+    p.y.resize(count);
+    p.z.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        p.x[i] = dist(rng);
+        p.y[i] = dist(rng);
+        p.z[i] = dist(rng);
+    }
+    return p;
+}
+
+void rotationMatrix(float angle, float m[16]) {
+    float c = std::cos(angle), s = std::sin(angle);
+    const float values[16] = {c, -s, 0, 1.5f, s * 0.5f, c, -s, -2.0f, s, 0.25f, c, 3.0f, 0, 0, 0, 1};
+    std::memcpy(m, values, sizeof(values));
+}
+
+bool sameBits(const std::vector<float>& a, const std::vector<float>& b) {
+    return std::memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0;
+}
+
+bool verifyKernels() {
+    bool ok = true;
+    const size_t sizes[] = {0, 1, 3, 4, 7, 8, 9, 15, 16, 17, 1000, 65537};
+    for (size_t size : sizes) {
+        for (int variant = 0; variant < 4; ++variant) {
+            float m[16];
+            rotationMatrix(0.3f + variant, m);
+            Positions reference = randomPositions(size, 42 + variant);
+            Positions input = reference;
+            TransformPositionsWith(KernelIsa::kScalar, m, reference.x.data(), reference.y.data(),
+                                   reference.z.data(), size);
+
+            for (KernelIsa isa : kAllIsas) {
+                if (!IsKernelIsaSupported(isa)) continue;
+                Positions p = input;
+                TransformPositionsWith(isa, m, p.x.data(), p.y.data(), p.z.data(), size);
+                if (!sameBits(p.x, reference.x) || !sameBits(p.y, reference.y) ||
+                    !sameBits(p.z, reference.z)) {
+                    std::printf("MISMATCH: %s, %zu vertices\n", GetKernelIsaName(isa), size);
+                    ok = false;
+                }
+            }
+            Positions p = input;
+            TransformPositions(m, p.x.data(), p.y.data(), p.z.data(), size);
+            if (!sameBits(p.x, reference.x) || !sameBits(p.y, reference.y) ||
+                !sameBits(p.z, reference.z)) {
+                std::printf("MISMATCH: parallel TransformPositions, %zu vertices\n", size);
+                ok = false;
+            }
+        }
+    }
+    return ok;
+}
+
+bool verifyProjection() {
+    bool ok = true;
+    const size_t sizes[] = {0, 1, 3, 4, 7, 8, 9, 15, 16, 17, 1000, 65537};
+    for (size_t size : sizes) {
+        float m[16];
+        rotationMatrix(0.7f, m);
+        m[12] = 0.001f;  // Перспектива: w зависит от вершины
+        m[14] = -0.33f;
+        Positions p = randomPositions(size, 200 + unsigned(size));
+        std::vector<float> reference[4], out[4];
+        for (int row = 0; row < 4; ++row) {
+            reference[row].resize(size);
+            out[row].resize(size);
+        }
+        ProjectPositionsWith(KernelIsa::kScalar, m, p.x.data(), p.y.data(), p.z.data(),
+                             reference[0].data(), reference[1].data(), reference[2].data(),
+                             reference[3].data(), size);
+        for (KernelIsa isa : kAllIsas) {
+            if (!IsKernelIsaSupported(isa)) continue;
+            ProjectPositionsWith(isa, m, p.x.data(), p.y.data(), p.z.data(), out[0].data(),
+                                 out[1].data(), out[2].data(), out[3].data(), size);
+            for (int row = 0; row < 4; ++row) {
+                if (sameBits(out[row], reference[row])) continue;
+                std::printf("MISMATCH: projection %s, %zu vertices\n", GetKernelIsaName(isa), size);
+                ok = false;
+                break;
+            }
+        }
+    }
+    return ok;
+}
+
+bool verifyBounds() {
+    bool ok = true;
+    const size_t sizes[] = {1, 3, 4, 7, 8, 9, 15, 16, 17, 1000, 65537, 300001};
+    for (size_t size : sizes) {
+        Positions p = randomPositions(size, 100 + unsigned(size));
+        const std::vector<float>* axes[3] = {&p.x, &p.y, &p.z};
+        float expectedMin[3], expectedMax[3];
+        for (int a = 0; a < 3; ++a) {
+            auto [lo, hi] = std::minmax_element(axes[a]->begin(), axes[a]->end());
+            expectedMin[a] = *lo;
+            expectedMax[a] = *hi;
+        }
+
+        auto check = [&](const char* name, const float* min, const float* max) {
+            if (std::memcmp(min, expectedMin, sizeof(expectedMin)) != 0 ||
+                std::memcmp(max, expectedMax, sizeof(expectedMax)) != 0) {
+                std::printf("MISMATCH: bounds %s, %zu vertices\n", name, size);
+                ok = false;
+            }
+        };
+        float min[3], max[3];
+        for (KernelIsa isa : kAllIsas) {
+            if (!IsKernelIsaSupported(isa)) continue;
+            ComputePositionBoundsWith(isa, p.x.data(), p.y.data(), p.z.data(), size, min, max);
+            check(GetKernelIsaName(isa), min, max);
+        }
+        ComputePositionBounds(p.x.data(), p.y.data(), p.z.data(), size, min, max);
+        check("parallel", min, max);
+    }
+    return ok;
+}
+
+template <typename Fn>
+double bestMilliseconds(Fn&& fn) {
+    double best = 1e300;
+    for (int i = 0; i < 5; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() < best) best = elapsed.count();
+    }
+    return best;
+}
+
+void benchKernels(size_t count) {
+    float m[16];
+    rotationMatrix(0.01f, m);
+    Positions p = randomPositions(count, 7);
+
+    std::printf("Transform of %zu vertices (best of 5):\n", count);
+    for (KernelIsa isa : kAllIsas) {
+        if (!IsKernelIsaSupported(isa)) continue;
+        double ms = bestMilliseconds([&]() {
+            TransformPositionsWith(isa, m, p.x.data(), p.y.data(), p.z.data(), count);
+        });
+        std::printf("  %-8s 1 thread   %8.2f ms\n", GetKernelIsaName(isa), ms);
+    }
+    double ms = bestMilliseconds([&]() {
+        TransformPositions(m, p.x.data(), p.y.data(), p.z.data(), count);
+    });
+    std::printf("  %-8s parallel   %8.2f ms\n", GetKernelIsaName(GetBestKernelIsa()), ms);
+
+    std::vector<float> clip[4];
+    for (auto& row : clip) row.resize(count);
+    std::printf("Projection of %zu vertices (best of 5):\n", count);
+    for (KernelIsa isa : kAllIsas) {
+        if (!IsKernelIsaSupported(isa)) continue;
+        ms = bestMilliseconds([&]() {
+            ProjectPositionsWith(isa, m, p.x.data(), p.y.data(), p.z.data(), clip[0].data(),
+                                 clip[1].data(), clip[2].data(), clip[3].data(), count);
+        });
+        std::printf("  %-8s 1 thread   %8.2f ms\n", GetKernelIsaName(isa), ms);
+    }
+
+    float min[3], max[3];
+    std::printf("Bounds of %zu vertices (best of 5):\n", count);
+    for (KernelIsa isa : kAllIsas) {
+        if (!IsKernelIsaSupported(isa)) continue;
+        ms = bestMilliseconds([&]() {
+            ComputePositionBoundsWith(isa, p.x.data(), p.y.data(), p.z.data(), count, min, max);
+        });
+        std::printf("  %-8s 1 thread   %8.2f ms\n", GetKernelIsaName(isa), ms);
+    }
+    ms = bestMilliseconds([&]() {
+        ComputePositionBounds(p.x.data(), p.y.data(), p.z.data(), count, min, max);
+    });
+    std::printf("  %-8s parallel   %8.2f ms\n", GetKernelIsaName(GetBestKernelIsa()), ms);
+}
+
+}  // namespace
+
+}  // namespace s21
+
+int main(int argc, char* argv[]) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+    bool ok = s21::verifyKernels();
+    std::printf("Kernel bit-compatibility: %s\n", ok ? "OK" : "FAILED");
+    bool projectionOk = s21::verifyProjection();
+    std::printf("Projection kernels: %s\n", projectionOk ? "OK" : "FAILED");
+    ok = ok && projectionOk;
+    bool boundsOk = s21::verifyBounds();
+    std::printf("Bounds kernels: %s\n", boundsOk ? "OK" : "FAILED");
+    ok = ok && boundsOk;
+    s21::benchKernels(count);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,234 @@
+// OBJ_GENERATOR.CPP - Реализация генератора OBJ файлов
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - ObjWriter: буфер текста, запись чисел через std::to_chars
+// - Сферу, сетку и случайный набор треугольников
+// - splitmix64 для воспроизводимых случайных чисел
+
+#include "obj_generator.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+
+namespace s21 {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+class ObjWriter {
+public:
+    explicit ObjWriter(const ObjGenerator::Sink& sink) : sink_(sink) {
+        buffer_.reserve(ObjGenerator::kChunkBytes + 256);
+    }
+    ~ObjWriter() { Flush(); }
+
+    void Vertex(double x, double y, double z) {
+        buffer_ += 'v';
+        number(x);
+        number(y);
+        number(z);
+        endLine();
+    }
+
+    // Индексы 1-based или отрицательные; withSlashes - "a/a/a"
+    void Face(const int64_t* indices, size_t count, bool withSlashes) {
+        buffer_ += 'f';
+        for (size_t i = 0; i < count; ++i) {
+            buffer_ += ' ';
+            index(indices[i]);
+            if (withSlashes) {
+                buffer_ += '/';
+                index(indices[i]);
+                buffer_ += '/';
+                index(indices[i]);
+            }
+        }
+        endLine();
+    }
+
+    void Comment(std::string_view text) {
+        buffer_ += "# ";
+        buffer_ += text;
+        endLine();
+    }
+
+    void Flush() {
+        if (buffer_.empty()) return;
+        sink_(buffer_);
+        buffer_.clear();
+    }
+
+private:
+    const ObjGenerator::Sink& sink_;
+    std::string buffer_;
+
+    void number(double value) {
+        char text[32];
+        text[0] = ' ';
+        auto [end, error] = std::to_chars(text + 1, text + sizeof(text), value, std::chars_format::fixed, 6);
+        buffer_.append(text, error == std::errc() ? end : text + 1);
+    }
+
+    void index(int64_t value) {
+        char text[24];
+        auto [end, error] = std::to_chars(text, text + sizeof(text), value);
+        buffer_.append(text, error == std::errc() ? end : text);
+    }
+
+    void endLine() {
+        buffer_ += '\n';
+        if (buffer_.size() >= ObjGenerator::kChunkBytes) Flush();
+    }
+};
+
+// splitmix64: одинаковая последовательность на любой платформе
+class Random {
+public:
+    explicit Random(uint64_t seed) : state_(seed) {}
+
+    uint64_t Next() {
+        uint64_t z = (state_ += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+    double Uniform() { return double(Next() >> 11) * (1.0 / 9007199254740992.0); }  // [0, 1)
+    size_t Below(size_t bound) { return size_t(Next() % bound); }
+
+private:
+    uint64_t state_;
+};
+
+void generateSphere(ObjWriter& out, size_t vertexCount) {
+    // 2 полюса + (rings - 1) * segments, segments = 2 * rings
+    size_t rings = std::max<size_t>(2, size_t(std::lround(std::sqrt(vertexCount / 2.0))));
+    size_t segments = rings * 2;
+    out.Vertex(0.0, 1.0, 0.0);
+    for (size_t ring = 1; ring < rings; ++ring) {
+        double theta = kPi * double(ring) / double(rings);
+        for (size_t segment = 0; segment < segments; ++segment) {
+            double phi = 2.0 * kPi * double(segment) / double(segments);
+            out.Vertex(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+        }
+    }
+    const int64_t south = int64_t(2 + (rings - 1) * segments);
+    out.Vertex(0.0, -1.0, 0.0);
+
+    auto at = [segments](size_t ring, size_t segment) {  // ring 1..rings-1
+        return int64_t(2 + (ring - 1) * segments + segment % segments);
+    };
+    for (size_t segment = 0; segment < segments; ++segment) {
+        const int64_t cap[3] = {1, at(1, segment + 1), at(1, segment)};
+        out.Face(cap, 3, false);
+    }
+    for (size_t ring = 1; ring + 1 < rings; ++ring) {
+        for (size_t segment = 0; segment < segments; ++segment) {
+            const int64_t quad[4] = {at(ring, segment), at(ring, segment + 1), at(ring + 1, segment + 1),
+                                     at(ring + 1, segment)};
+            out.Face(quad, 4, false);
+        }
+    }
+    for (size_t segment = 0; segment < segments; ++segment) {
+        const int64_t cap[3] = {south, at(rings - 1, segment), at(rings - 1, segment + 1)};
+        out.Face(cap, 3, false);
+    }
+}
+
+void generateGrid(ObjWriter& out, size_t vertexCount) {
+    size_t side = std::max<size_t>(2, size_t(std::lround(std::sqrt(double(vertexCount)))));
+    for (size_t i = 0; i < side; ++i) {
+        for (size_t j = 0; j < side; ++j) {
+            double u = double(i) / double(side - 1), v = double(j) / double(side - 1);
+            out.Vertex(u, v, 0.05 * std::sin(8.0 * u) * std::cos(8.0 * v));
+        }
+    }
+    for (size_t i = 0; i + 1 < side; ++i) {
+        for (size_t j = 0; j + 1 < side; ++j) {
+            int64_t a = int64_t(i * side + j + 1), b = a + 1, c = a + int64_t(side), d = c + 1;
+            const int64_t first[3] = {a, b, d};
+            const int64_t second[3] = {a, d, c};
+            out.Face(first, 3, true);
+            out.Face(second, 3, true);
+        }
+    }
+}
+
+void generateSoup(ObjWriter& out, size_t vertexCount, uint64_t seed) {
+    vertexCount = std::max<size_t>(3, vertexCount);
+    Random random(seed);
+    for (size_t i = 0; i < vertexCount; ++i) {
+        out.Vertex(random.Uniform() * 2.0 - 1.0, random.Uniform() * 2.0 - 1.0, random.Uniform() * 2.0 - 1.0);
+    }
+    // Все вершины уже прочитаны: -k - k-я с конца
+    for (size_t face = 0; face < vertexCount; ++face) {
+        const int64_t triangle[3] = {-int64_t(random.Below(vertexCount) + 1),
+                                     -int64_t(random.Below(vertexCount) + 1),
+                                     -int64_t(random.Below(vertexCount) + 1)};
+        out.Face(triangle, 3, false);
+    }
+}
+
+void generateCloud(ObjWriter& out, size_t vertexCount, uint64_t seed) {
+    Random random(seed);
+    for (size_t i = 0; i < vertexCount; ++i) {
+        double u = random.Uniform(), v = random.Uniform();
+        double height = 0.1 * std::sin(6.0 * u) * std::cos(5.0 * v) + 0.005 * (random.Uniform() - 0.5);
+        out.Vertex(u * 2.0 - 1.0, height, v * 2.0 - 1.0);
+    }
+}
+
+}  // namespace
+
+const char* GetObjShapeName(ObjShape shape) {
+    switch (shape) {
+        case ObjShape::kSphere: return "sphere";
+        case ObjShape::kGrid: return "grid";
+        case ObjShape::kSoup: return "soup";
+        case ObjShape::kCloud: return "cloud";
+    }
+    return "unknown";
+}
+
+bool ParseObjShape(std::string_view name, ObjShape& shape) {
+    for (ObjShape candidate : {ObjShape::kSphere, ObjShape::kGrid, ObjShape::kSoup, ObjShape::kCloud}) {
+        if (name == GetObjShapeName(candidate)) {
+            shape = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ObjGenerator::GenerateObj(ObjShape shape, size_t vertexCount, const Sink& sink, uint64_t seed) {
+    ObjWriter out(sink);
+    out.Comment(std::string("s21 generated ") + GetObjShapeName(shape) + " " + std::to_string(vertexCount) +
+                " seed " + std::to_string(seed));
+    switch (shape) {
+        case ObjShape::kSphere: generateSphere(out, vertexCount); break;
+        case ObjShape::kGrid: generateGrid(out, vertexCount); break;
+        case ObjShape::kSoup: generateSoup(out, vertexCount, seed); break;
+        case ObjShape::kCloud: generateCloud(out, vertexCount, seed); break;
+    }
+}
+
+std::string ObjGenerator::GenerateObjText(ObjShape shape, size_t vertexCount, uint64_t seed) {
+    std::string text;
+    GenerateObj(shape, vertexCount, [&text](std::string_view chunk) { text += chunk; }, seed);
+    return text;
+}
+
+bool ObjGenerator::WriteObjFile(const std::string& path, ObjShape shape, size_t vertexCount, uint64_t seed) {
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> file(std::fopen(path.c_str(), "wb"), &std::fclose);
+    if (!file) return false;
+    bool ok = true;
+    GenerateObj(shape, vertexCount, [&](std::string_view chunk) {
+        ok = ok && std::fwrite(chunk.data(), 1, chunk.size(), file.get()) == chunk.size();
+    }, seed);
+    return std::fclose(file.release()) == 0 && ok;
+}
+
+}  // namespace s21
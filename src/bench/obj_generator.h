@@ -0,0 +1,71 @@
+// OBJ_GENERATOR.H - Детерминированный генератор OBJ файлов для бенчмарков
+//
+// ЗАЧЕМ НУЖЕН:
+// Бенчмаркам нужны модели от тысяч до десятков миллионов вершин, а внешние
+// файлы в репозиторий не кладутся. Генератор строит OBJ текст заданного
+// размера: одинаковые аргументы дают одинаковые байты на любой машине,
+// поэтому результаты разных запусков сравнимы.
+//
+// ЧТО СОДЕРЖИТ:
+// - ObjShape - форма модели (сфера, сетка, случайный набор треугольников,
+//   облако точек)
+// - GenerateObj() - текст по кускам в обработчик (файлы больше памяти)
+// - GenerateObjText(), WriteObjFile() - текст целиком / в файл
+//
+// КАК РАБОТАЕТ:
+// 1. kSphere: UV-сфера, rings x 2*rings вершин, четырехугольники и
+//    треугольники у полюсов, грани "f a b c d"
+// 2. kGrid: квадратная сетка side x side с волнистой высотой, треугольники
+//    в формате "f a/a/a b/b/b c/c/c" (как экспорт с текстурами и нормалями)
+// 3. kSoup: случайные вершины в кубе и столько же треугольников из
+//    случайных вершин, отрицательные (относительные) индексы
+// 3a. kCloud: облако точек как у скана LiDAR - только строки "v", точки
+//    на волнистой поверхности со случайным шумом высоты, граней нет
+// 4. Случайные числа - splitmix64 с заданным seed (не std::*_distribution,
+//    их результат зависит от стандартной библиотеки); числа пишутся
+//    std::to_chars с 6 знаками после точки
+// 5. Текст копится в буфере kChunkBytes и отдается обработчику кусками
+//
+// Все в namespace s21
+
+#ifndef OBJ_GENERATOR_H_
+#define OBJ_GENERATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace s21 {
+
+enum class ObjShape {
+    kSphere,
+    kGrid,
+    kSoup,
+    kCloud
+};
+
+const char* GetObjShapeName(ObjShape shape);               // "sphere", "grid", "soup", "cloud"
+bool ParseObjShape(std::string_view name, ObjShape& shape);
+
+class ObjGenerator {
+public:
+    static constexpr size_t kChunkBytes = 1u << 20;
+    static constexpr uint64_t kDefaultSeed = 21;
+
+    using Sink = std::function<void(std::string_view)>;
+
+    // Примерно vertexCount вершин (точное число зависит от формы)
+    static void GenerateObj(ObjShape shape, size_t vertexCount, const Sink& sink,
+                            uint64_t seed = kDefaultSeed);
+    static std::string GenerateObjText(ObjShape shape, size_t vertexCount,
+                                       uint64_t seed = kDefaultSeed);
+    // false - файл не удалось записать
+    static bool WriteObjFile(const std::string& path, ObjShape shape, size_t vertexCount,
+                             uint64_t seed = kDefaultSeed);
+};
+
+}  // namespace s21
+
+#endif  // OBJ_GENERATOR_H_
@@ -7,8 +7,12 @@
 //
 // ЧТО РЕАЛИЗУЕТ:
 // - Связывание сигналов View с слотами Controller (connectSignals)
-// - Обработка загрузки файла модели (onLoadFile)
-// - Обработка команд трансформации (onMove, onRotate, onScale)
+// - Обработка загрузки файла модели (onLoadFile) - в фоне, с прогрессом,
+//   черновыми Mesh и отменой (onCancelLoad)
+// - Обработка команд трансформации (onMove, onRotate, onScale, onTransform):
+//   шаги объединяются в одну матрицу до отложенного flushTransform()
+// - Сборки: добавление объектов в сцену Model (onAddObject, onClearScene)
+// - Экспорт замеров Profiler в Chrome Trace (onExportTrace)
 // - Получение данных из Model и передача в View
 // - Обработка ошибок и показ их пользователю
 // - Координация между Model и View
@@ -16,11 +20,13 @@
 // - Обработка настроек отображения
 //
 // КАК РАБОТАЕТ:
-// 1. Конструктор: создает Model и View, связывает сигналы
-// 2. connectSignals(): связывает сигналы View с слотами Controller
+// 1. Конструктор: получает Model и MainWindow (их создает main()),
+//    передает Model в View только для чтения
+// 2. connectSignals(): связывает сигналы MainWindow с слотами Controller
 // 3. Слоты обработки:
 //    - onLoadFile(): вызывает model.LoadScene(), обновляет View
-//    - onMove/onRotate/onScale(): вызывает model.Transform(), обновляет View
+//    - onMove/onRotate/onScale/onTransform(): копят шаг, flushTransform()
+//      вызывает model.TransformMesh() один раз и обновляет View
 //    - onSettingsChanged(): обновляет настройки отображения
 // 4. Методы обновления View:
 //    - updateModelInfo(): передает информацию о mesh'е в View
@@ -39,3 +45,138 @@
 // - Тонкий слой согласно принципам MVC
 // - Делегирование всех операций в соответствующие компоненты
 // - Минимальная логика, максимальная координация
+
+#include "controller.h"
+
+#include "../model/mesh_loader.h"  // MeshLoadHandlers
+#include "../model/profiler.h"     // Profiler
+#include "../view/mainwindow.h"
+
+namespace s21 {
+
+Controller::Controller(Model* model, MainWindow* view) : model_(model), view_(view) {
+    view_->setModel(model_);
+    connectSignals();
+}
+
+Controller::~Controller() {
+    model_->StopLoading();  // Рабочий поток больше не вызовет postToGui()
+}
+
+void Controller::connectSignals() {
+    // dispatcher_ - контекст связи: слоты отключаются вместе с Controller
+    QObject::connect(view_, &MainWindow::signalLoadFile, &dispatcher_,
+                     [this](const std::string& path) { onLoadFile(path); });
+    QObject::connect(view_, &MainWindow::signalCancelLoad, &dispatcher_, [this]() { onCancelLoad(); });
+    QObject::connect(view_, &MainWindow::signalTransform, &dispatcher_,
+                     [this](const TransformMatrix& step) { onTransformModel(step); });
+}
+
+void Controller::onLoadFile(const std::string& path) {
+    // Обработчики вызываются в потоке загрузки - переносим в GUI поток
+    // вместе с номером загрузки
+    const uint64_t id = ++load_id_;
+    MeshLoadHandlers handlers;
+    handlers.on_progress = [this, id](const LoadProgress& progress) {
+        postToGui([this, id, progress]() { onLoadProgress(id, progress); });
+    };
+    handlers.on_partial = [this, id](std::shared_ptr<const Mesh> preview, const LoadProgress&) {
+        postToGui([this, id, preview = std::move(preview)]() { onPartialMesh(id, preview); });
+    };
+    handlers.on_finished = [this, id](FacadeOperationResult result, MeshAccelerators accelerators) {
+        postToGui([this, id, result = std::move(result),
+                   accelerators = std::move(accelerators)]() mutable {
+            onLoadFinished(id, std::move(result), std::move(accelerators));
+        });
+    };
+    
+    FacadeOperationResult started = model_->LoadMeshAsync(path, std::move(handlers));
+    if (started.IsError()) view_->showError(started.GetErrorMessage());
+}
+
+void Controller::onCancelLoad() {
+    model_->CancelLoading();
+}
+
+void Controller::onLoadProgress(uint64_t loadId, const LoadProgress& progress) {
+    if (loadId != load_id_) return;  // Загрузка уже заменена новой
+    view_->showLoadProgress(progress);
+}
+
+void Controller::onPartialMesh(uint64_t loadId, std::shared_ptr<const Mesh> preview) {
+    // Черновик показывается только пока его загрузка - текущая и не завершилась
+    if (loadId == load_id_ && model_->IsLoading()) view_->showPreview(std::move(preview));
+}
+
+void Controller::onLoadFinished(uint64_t loadId, FacadeOperationResult result,
+                                MeshAccelerators accelerators) {
+    if (loadId != load_id_) return;  // Результат замененной загрузки (обычно отмена)
+    view_->clearPreview();
+    if (result.IsError()) {
+        if (result.GetErrorMessage() != kLoadCancelledMessage) {
+            view_->showError(result.GetErrorMessage());
+        }
+        view_->updateDisplay();
+        return;
+    }
+    
+    model_->SetLoadedMesh(result.TakeMesh(), std::move(accelerators));
+    view_->updateModelInfo();
+    view_->updateDisplay();
+}
+
+void Controller::onMoveModel(double x, double y, double z) {
+    queueTransform(TransformMatrixBuilder::CreateMoveMatrix(x, y, z));
+}
+
+void Controller::onRotateModel(double x, double y, double z) {
+    queueTransform(TransformMatrixBuilder::CreateRotationMatrix(x, y, z));
+}
+
+void Controller::onScaleModel(double x, double y, double z) {
+    queueTransform(TransformMatrixBuilder::CreateScaleMatrix(x, y, z));
+}
+
+void Controller::onTransformModel(const TransformMatrix& step) {
+    queueTransform(step);
+}
+
+void Controller::onAddObject(const std::string& path, const TransformMatrix& transform) {
+    FacadeOperationResult result = model_->AddObject(path, transform);
+    if (result.IsError()) {
+        view_->showError(result.GetErrorMessage());
+        return;
+    }
+    view_->updateDisplay();
+}
+
+void Controller::onClearScene() {
+    model_->ClearScene();
+    view_->updateDisplay();
+}
+
+void Controller::onExportTrace(const std::string& path) {
+    if (!Profiler::Instance().WriteChromeTrace(path)) {
+        view_->showError("Cannot write trace " + path);
+    }
+}
+
+void Controller::queueTransform(const TransformMatrix& step) {
+    pending_transform_ = step.Multiply(pending_transform_);  // Новый шаг - после накопленных
+    if (transform_queued_) return;
+    transform_queued_ = true;
+    postToGui([this]() { flushTransform(); });
+}
+
+void Controller::flushTransform() {
+    transform_queued_ = false;
+    FacadeOperationResult result = model_->TransformMesh(pending_transform_);
+    pending_transform_ = TransformMatrix();
+    if (result.IsError()) {
+        view_->showError(result.GetErrorMessage());
+        return;
+    }
+    view_->updateDisplay();
+}
+
+}  // namespace s21
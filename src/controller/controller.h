@@ -22,11 +22,41 @@
 // 5. Обрабатывает ошибки и показывает их пользователю
 //
 // СВЯЗИ MVC:
+// - View - MainWindow (view/mainwindow.h); конструктор связывает его сигналы
+//   (загрузка, отмена, шаг мыши ModelWidget) со слотами Controller
 // - View -> Controller: сигналы (пользовательские действия)
 // - Controller -> Model: вызовы методов (бизнес-операции)
 // - Model -> Controller: результаты операций
 // - Controller -> View: обновление данных и состояния
 //
+// ФОНОВАЯ ЗАГРУЗКА:
+// - onLoadFile() запускает model.LoadMeshAsync(), GUI не блокируется
+// - Прогресс и черновые Mesh приходят из рабочего потока и переносятся
+//   в GUI поток через dispatcher_ (QMetaObject::invokeMethod, QueuedConnection)
+// - onCancelLoad() отменяет загрузку, текущая модель остается
+// - Каждая загрузка получает номер (load_id_); отложенные вызовы несут
+//   номер своей загрузки, вызовы замененной загрузки (уже стоящие в
+//   очереди GUI потока) отбрасываются - ее черновик или результат не
+//   появляются поверх новой
+//
+// СБОРКИ:
+// - onAddObject() добавляет в сцену Model объект файла со своей матрицей;
+//   повторный файл берется из кэша геометрии Model без разбора
+// - onClearScene() убирает все объекты, основной mesh остается
+//
+// ОБЪЕДИНЕНИЕ ТРАНСФОРМАЦИЙ:
+// - onMoveModel/onRotateModel/onScaleModel/onTransformModel не применяют
+//   шаг сразу: он домножается на pending_transform_, и в GUI поток ставится
+//   один отложенный flushTransform()
+// - Все шаги, пришедшие до него (пачка событий одной итерации цикла событий),
+//   попадают в Model одной матрицей, View перерисовывается один раз
+// - ModelWidget сам объединяет движения мыши по тикам кадра и присылает
+//   один onTransformModel на тик
+//
+// ПРОФИЛИРОВАНИЕ:
+// - onExportTrace() сохраняет замеры Profiler (загрузка, трансформация,
+//   кадры) в JSON для chrome://tracing; ошибка записи - showError()
+//
 // ПРИНЦИПЫ MVC:
 // - НИКАКОЙ бизнес-логики, только координация
 // - НИКАКОГО UI кода, только логика взаимодействия
@@ -36,15 +66,59 @@
 //
 // Все в namespace s21
 
+#ifndef CONTROLLER_H_
+#define CONTROLLER_H_
+
+#include <QObject>
+#include <memory>
+#include <string>
+
+#include "../model/io.h"        // LoadProgress
+#include "../model/model.h"     // Model, Mesh, FacadeOperationResult, MeshAccelerators
+
 namespace s21 {
+    class MainWindow;
+    
     class Controller {
         Model* model_;
-        View* view_;
+        MainWindow* view_;
+        QObject dispatcher_;  // Живет в GUI потоке, получатель отложенных вызовов
+        TransformMatrix pending_transform_;  // Шаги с прошлого flushTransform()
+        bool transform_queued_ = false;
+        uint64_t load_id_ = 0;  // Номер последней onLoadFile()
         
     public:
+        // model и view живут дольше Controller; сигналы view связываются здесь
+        Controller(Model* model, MainWindow* view);
+        ~Controller();  // Останавливает фоновую загрузку: ее обработчики ссылаются на this
+        Controller(const Controller&) = delete;
+        Controller& operator=(const Controller&) = delete;
+        
         void onLoadFile(const std::string& path);
+        void onCancelLoad();
         void onMoveModel(double x, double y, double z);
         void onRotateModel(double x, double y, double z);
         void onScaleModel(double x, double y, double z);
+        void onTransformModel(const TransformMatrix& step);  // ModelWidget::signalTransform
+        void onAddObject(const std::string& path, const TransformMatrix& transform);
+        void onClearScene();
+        void onExportTrace(const std::string& path);
+        
+    private:
+        void connectSignals();
+        // loadId - номер загрузки, для которой вызов был отложен
+        void onLoadProgress(uint64_t loadId, const LoadProgress& progress);
+        void onPartialMesh(uint64_t loadId, std::shared_ptr<const Mesh> preview);
+        void onLoadFinished(uint64_t loadId, FacadeOperationResult result, MeshAccelerators accelerators);
+        void queueTransform(const TransformMatrix& step);
+        void flushTransform();
+        
+        // Выполнить fn в GUI потоке (из любого потока)
+        template <typename Fn>
+        void postToGui(Fn&& fn) {
+            QMetaObject::invokeMethod(&dispatcher_, std::forward<Fn>(fn), Qt::QueuedConnection);
+        }
     };
 }
+
+#endif  // CONTROLLER_H_
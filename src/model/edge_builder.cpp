@@ -0,0 +1,86 @@
+// EDGE_BUILDER.CPP - Реализация построения уникальных ребер
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - Хэш-множество uint64 с открытой адресацией и линейным пробированием
+// - Хэш: умножение на 2^64 / phi (Fibonacci hashing), старшие биты
+// - Заполнение не выше 3/4, при превышении таблица удваивается
+// - Начальный размер: ~3/4 ребер граней (для замкнутой модели уникальных
+//   ребер вдвое меньше, чем ребер граней)
+// - Список ребер растет на 1/4, а не вдвое: он переносится в Mesh без
+//   копирования, и лишняя емкость осталась бы в модели
+
+#include "edge_builder.h"
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+namespace s21 {
+
+void EdgeBuilder::Begin(size_t faceEdgeCount) {
+    size_t capacity = std::bit_ceil(std::max<size_t>(16, faceEdgeCount * 3 / 4 + 1));
+    if (table_.size() != capacity) {
+        table_.assign(capacity, kEmpty);
+    } else {
+        std::fill(table_.begin(), table_.end(), kEmpty);
+    }
+    mask_ = capacity - 1;
+    used_ = 0;
+    edges_.clear();
+    // Замкнутая модель: каждое ребро в двух гранях -> ровно faceEdgeCount индексов;
+    // запас 1/8 на граничные ребра открытых моделей (сканы)
+    edges_.reserve(faceEdgeCount + faceEdgeCount / 8);
+}
+
+void EdgeBuilder::AddFace(const int* indices, size_t count) {
+    if (count < 2) return;
+    for (size_t i = 0; i + 1 < count; ++i) {
+        insert(static_cast<uint32_t>(indices[i]), static_cast<uint32_t>(indices[i + 1]));
+    }
+    if (count > 2) {
+        insert(static_cast<uint32_t>(indices[count - 1]), static_cast<uint32_t>(indices[0]));
+    }
+}
+
+std::vector<uint32_t> EdgeBuilder::TakeEdges() {
+    std::vector<uint32_t> result = std::move(edges_);
+    edges_ = std::vector<uint32_t>();
+    return result;
+}
+
+size_t EdgeBuilder::slotOf(uint64_t key, size_t mask) {
+    return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+}
+
+void EdgeBuilder::insert(uint32_t a, uint32_t b) {
+    if (a == b) return;
+    if (a > b) std::swap(a, b);
+    uint64_t key = (uint64_t(a) << 32) | b;
+
+    size_t slot = slotOf(key, mask_);
+    while (table_[slot] != kEmpty) {
+        if (table_[slot] == key) return;
+        slot = (slot + 1) & mask_;
+    }
+    table_[slot] = key;
+    // Рост на 1/4 вместо удвоения: список ребер уходит в Mesh как есть
+    if (edges_.size() + 2 > edges_.capacity()) edges_.reserve(edges_.size() + edges_.size() / 4 + 2);
+    edges_.push_back(a);
+    edges_.push_back(b);
+
+    if (++used_ * 4 > table_.size() * 3) rehash(table_.size() * 2);
+}
+
+void EdgeBuilder::rehash(size_t capacity) {
+    std::vector<uint64_t> old = std::move(table_);
+    table_.assign(capacity, kEmpty);
+    mask_ = capacity - 1;
+    for (uint64_t key : old) {
+        if (key == kEmpty) continue;
+        size_t slot = slotOf(key, mask_);
+        while (table_[slot] != kEmpty) slot = (slot + 1) & mask_;
+        table_[slot] = key;
+    }
+}
+
+}  // namespace s21
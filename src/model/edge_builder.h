@@ -0,0 +1,59 @@
+// EDGE_BUILDER.H - Построение списка уникальных ребер из граней
+//
+// ЗАЧЕМ НУЖЕН:
+// Каждое внутреннее ребро замкнутой модели принадлежит двум граням.
+// Если превращать каждую грань в ребра по контуру, Mesh получает вдвое
+// больше ребер, чем нужно, и каждая линия рисуется дважды.
+//
+// ЧТО СОДЕРЖИТ:
+// - EdgeBuilder класс - дедупликация ребер через хэш-множество
+//   с открытой адресацией (ключ - пара индексов, упакованная в 64 бита)
+//
+// КАК РАБОТАЕТ:
+// 1. Begin() - очистка таблицы под ожидаемое число ребер граней
+//    (память таблицы сохраняется между загрузками)
+// 2. AddFace() - ребра по контуру грани (v0-v1, v1-v2, ..., vn-v0)
+// 3. Ребро приводится к виду (min, max) и упаковывается: min << 32 | max
+// 4. Новый ключ -> пара добавляется в выходной список, повтор пропускается
+// 5. Вырожденные ребра (v-v) отбрасываются
+// 6. GetEdges() - ребра, построенные на текущий момент (можно продолжать AddFace)
+// 7. TakeEdges() - канонический список: пары (min, max) в порядке первого
+//    появления в файле (детерминирован для одного и того же файла)
+//
+// Все в namespace s21
+
+#ifndef EDGE_BUILDER_H_
+#define EDGE_BUILDER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace s21 {
+
+class EdgeBuilder {
+public:
+    void Begin(size_t faceEdgeCount);                 // Число ребер граней до дедупликации
+    void AddFace(const int* indices, size_t count);   // Индексы вершин грани (0-based, валидные)
+    std::vector<uint32_t> TakeEdges();                // b0 e0 b1 e1 ... (после - Begin заново)
+
+    size_t GetEdgeCount() const { return edges_.size() / 2; }
+    std::span<const uint32_t> GetEdges() const { return edges_; }  // Уже построенные ребра
+
+private:
+    static constexpr uint64_t kEmpty = ~uint64_t(0);  // Недостижим: min < max
+
+    std::vector<uint64_t> table_;   // Открытая адресация, линейное пробирование
+    size_t mask_ = 0;               // table_.size() - 1 (размер - степень двойки)
+    size_t used_ = 0;
+    std::vector<uint32_t> edges_;
+
+    void insert(uint32_t a, uint32_t b);
+    void rehash(size_t capacity);
+    static size_t slotOf(uint64_t key, size_t mask);
+};
+
+}  // namespace s21
+
+#endif  // EDGE_BUILDER_H_
@@ -0,0 +1,142 @@
+// EDGE_GRID.CPP - Реализация пространственного индекса ребер
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - gridSize(): размер ячейки и число ячеек по осям под kEdgesPerCell
+// - Номер ячейки середины каждого ребра (параллельно по блокам)
+// - Сортировку подсчетом номеров ребер по ячейкам (последовательно, стабильно)
+// - Границы непустых ячеек по концам ребер (параллельно по ячейкам)
+
+#include "edge_grid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "parallel.h"
+
+namespace s21 {
+
+namespace {
+
+constexpr size_t kEdgeBlock = 1u << 16;  // Ребер в одной параллельной задаче
+constexpr size_t kCellBlock = 1u << 10;  // Ячеек в одной параллельной задаче
+
+bool isCancelled(const std::atomic<bool>* cancelled) {
+    return cancelled && cancelled->load(std::memory_order_relaxed);
+}
+
+// Ячейки - кубы со стороной cellSize; вдоль плоских осей ячеек меньше,
+// поэтому сторона уточняется, пока общее число не приблизится к целевому
+void gridSize(const double extent[3], size_t targetCells, uint32_t dims[3], double& cellSize) {
+    double largest = std::max({extent[0], extent[1], extent[2]});
+    cellSize = largest / std::cbrt(double(targetCells));
+    for (int pass = 0; pass < 3; ++pass) {
+        double cells = 1.0;
+        for (int axis = 0; axis < 3; ++axis) {
+            double count = std::ceil(extent[axis] / cellSize);
+            dims[axis] = uint32_t(std::clamp(count, 1.0, double(EdgeGrid::kMaxCellsPerAxis)));
+            cells *= dims[axis];
+        }
+        if (pass < 2) cellSize *= std::cbrt(cells / double(targetCells));
+    }
+}
+
+}  // namespace
+
+bool EdgeGrid::Build(const Mesh& mesh, const std::atomic<bool>* cancelled) {
+    clear();
+    const size_t edgeCount = mesh.GetEdgeCount();
+    if (edgeCount < kMinEdges || mesh.IsCompact()) return true;  // Сжатые ребра - без индекса
+
+    std::span<const float> x = mesh.GetX(), y = mesh.GetY(), z = mesh.GetZ();
+    std::span<const uint32_t> edges = mesh.GetEdgeIndices();
+    BoundingBox bounds = mesh.ComputeBounds();
+    const double origin[3] = {bounds.min.x, bounds.min.y, bounds.min.z};
+    const double extent[3] = {bounds.max.x - bounds.min.x, bounds.max.y - bounds.min.y,
+                              bounds.max.z - bounds.min.z};
+    if (std::max({extent[0], extent[1], extent[2]}) <= 0.0) return true;  // Все вершины в одной точке
+
+    uint32_t dims[3];
+    double cellSize;
+    gridSize(extent, edgeCount / kEdgesPerCell, dims, cellSize);
+    const float inverse = float(1.0 / cellSize);
+    auto cellIndex = [&](float a, float b, int axis) {
+        float cell = ((a + b) * 0.5f - float(origin[axis])) * inverse;
+        return std::min(uint32_t(std::max(cell, 0.0f)), dims[axis] - 1);
+    };
+
+    // 1. Ячейка середины каждого ребра
+    std::vector<uint32_t> cellOf(edgeCount);
+    ParallelFor((edgeCount + kEdgeBlock - 1) / kEdgeBlock, [&](size_t block) {
+        size_t end = std::min(edgeCount, (block + 1) * kEdgeBlock);
+        for (size_t e = block * kEdgeBlock; e < end; ++e) {
+            uint32_t a = edges[e * 2], b = edges[e * 2 + 1];
+            cellOf[e] = (cellIndex(z[a], z[b], 2) * dims[1] + cellIndex(y[a], y[b], 1)) * dims[0] +
+                        cellIndex(x[a], x[b], 0);
+        }
+    });
+    if (isCancelled(cancelled)) return false;
+
+    // 2. Сортировка подсчетом: offsets[cell] - начало ребер ячейки
+    const size_t gridCells = size_t(dims[0]) * dims[1] * dims[2];
+    std::vector<uint32_t> offsets(gridCells + 1, 0);
+    for (uint32_t cell : cellOf) ++offsets[cell + 1];
+    for (size_t cell = 0; cell < gridCells; ++cell) offsets[cell + 1] += offsets[cell];
+
+    std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+    edge_ids_.resize(edgeCount);
+    for (size_t e = 0; e < edgeCount; ++e) edge_ids_[cursor[cellOf[e]]++] = uint32_t(e);
+    cellOf = {};
+    cursor = {};
+    if (isCancelled(cancelled)) {
+        clear();
+        return false;
+    }
+
+    for (size_t cell = 0; cell < gridCells; ++cell) {
+        uint32_t count = offsets[cell + 1] - offsets[cell];
+        if (count > 0) cells_.push_back(EdgeGridCell{{}, {}, offsets[cell], count});
+    }
+
+    // 3. Границы ячеек по концам ребер
+    const size_t cellCount = cells_.size();
+    ParallelFor((cellCount + kCellBlock - 1) / kCellBlock, [&](size_t block) {
+        size_t end = std::min(cellCount, (block + 1) * kCellBlock);
+        for (size_t c = block * kCellBlock; c < end; ++c) {
+            EdgeGridCell& cell = cells_[c];
+            float lo[3], hi[3];
+            std::fill(lo, lo + 3, std::numeric_limits<float>::max());
+            std::fill(hi, hi + 3, std::numeric_limits<float>::lowest());
+            for (uint32_t i = cell.first; i < cell.first + cell.count; ++i) {
+                size_t edge = edge_ids_[i];
+                for (uint32_t v : {edges[edge * 2], edges[edge * 2 + 1]}) {
+                    lo[0] = std::min(lo[0], x[v]);
+                    lo[1] = std::min(lo[1], y[v]);
+                    lo[2] = std::min(lo[2], z[v]);
+                    hi[0] = std::max(hi[0], x[v]);
+                    hi[1] = std::max(hi[1], y[v]);
+                    hi[2] = std::max(hi[2], z[v]);
+                }
+            }
+            std::copy(lo, lo + 3, cell.min);
+            std::copy(hi, hi + 3, cell.max);
+        }
+    });
+
+    source_ = x.data();
+    edge_count_ = edgeCount;
+    return true;
+}
+
+bool EdgeGrid::IsBuiltFor(const Mesh& mesh) const {
+    return !cells_.empty() && source_ == mesh.GetX().data() && edge_count_ == mesh.GetEdgeCount();
+}
+
+void EdgeGrid::clear() {
+    cells_.clear();
+    edge_ids_.clear();
+    source_ = nullptr;
+    edge_count_ = 0;
+}
+
+}  // namespace s21
@@ -0,0 +1,78 @@
+// EDGE_GRID.H - Пространственный индекс ребер mesh'а (равномерная сетка)
+//
+// ЗАЧЕМ НУЖЕН:
+// При сильном приближении на экране видна малая часть скана, но без индекса
+// каждый кадр проецирует и отдает QPainter все 20M ребер. Сетка группирует
+// ребра по ячейкам пространства: View проверяет ограничивающие
+// параллелепипеды ячеек против области вывода и рисует только видимые.
+// Время кадра зависит от видимой части модели, а не от ее размера.
+//
+// ЧТО СОДЕРЖИТ:
+// - EdgeGridCell - границы ячейки и диапазон ее ребер
+// - EdgeGrid класс - построение при загрузке и доступ к ячейкам
+//
+// КАК РАБОТАЕТ:
+// 1. Границы mesh'а делятся на ячейки одинакового размера (кубы), число
+//    ячеек ~ ребра / kEdgesPerCell; вдоль плоской оси ячейка одна
+// 2. Ребро попадает в ячейку своей середины (номера ячеек - параллельно)
+// 3. Сортировка подсчетом: номера ребер одной ячейки лежат подряд,
+//    внутри ячейки - в порядке mesh'а (результат не зависит от числа потоков)
+// 4. Границы ячейки - по концам ее ребер (ребро может выходить за ячейку
+//    сетки), пустые ячейки не хранятся
+// 5. Координаты - локальные координаты mesh'а: на ячейки действует та же
+//    матрица модели, что и на вершины
+// 6. IsBuiltFor(): индекс относится к mesh'у с тем же буфером координат
+//    и числом ребер (уровни LOD и черновые mesh'и индекса не имеют).
+//    Для сжатого mesh'а (mesh_codec.h) индекс не строится: номера ребер
+//    требуют массива ребер, который сжатие и убирает
+//
+// Все в namespace s21
+
+#ifndef EDGE_GRID_H_
+#define EDGE_GRID_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "model.h"  // Mesh
+
+namespace s21 {
+
+struct EdgeGridCell {
+    float min[3];
+    float max[3];
+    uint32_t first;  // Начало в GetEdgeIds()
+    uint32_t count;
+};
+
+class EdgeGrid {
+public:
+    static constexpr size_t kMinEdges = 1u << 18;       // Меньшие модели рисуются без отсечения
+    static constexpr size_t kEdgesPerCell = 512;
+    static constexpr uint32_t kMaxCellsPerAxis = 1024;
+
+    // true - индекс построен (пустой для маленькой модели);
+    // false - построение отменено через cancelled
+    bool Build(const Mesh& mesh, const std::atomic<bool>* cancelled = nullptr);
+
+    bool IsEmpty() const { return cells_.empty(); }
+    bool IsBuiltFor(const Mesh& mesh) const;
+
+    std::span<const EdgeGridCell> GetCells() const { return cells_; }  // Только непустые
+    std::span<const uint32_t> GetEdgeIds() const { return edge_ids_; } // Номера ребер mesh'а
+
+private:
+    std::vector<EdgeGridCell> cells_;
+    std::vector<uint32_t> edge_ids_;
+    const float* source_ = nullptr;   // Ключ: буфер координат и число ребер
+    size_t edge_count_ = 0;
+
+    void clear();
+};
+
+}  // namespace s21
+
+#endif  // EDGE_GRID_H_
@@ -2,28 +2,54 @@
 //
 // ЗАЧЕМ НУЖЕН:
 // Реализует всю геометрическую логику 3D объектов. Обеспечивает корректные
-// аффинные преобразования через матрицы. Использует библиотеку s21_matrix+
-// для матричных операций.
+// аффинные преобразования через матрицы. Матричные операции - Mat4
+// (mat4.h): фиксированный размер, на стеке, без выделения памяти.
 //
 // ЧТО РЕАЛИЗУЕТ:
-// - 3DPoint: базовые операции с 3D точками (сложение, вычитание, нормализация)
-// - TransformMatrix: умножение матриц, применение к точкам, комбинирование трансформаций
+// - Point3D: базовые операции с 3D точками (сложение, вычитание, нормализация)
+// - TransformMatrix: умножение матриц, применение к точкам, комбинирование трансформаций,
+//   выгрузка в float[16] для пакетного ядра TransformPositions
 // - TransformMatrixBuilder: создание матриц поворота (по осям X,Y,Z), перемещения, масштабирования
-// - Vertex: трансформация позиции через матрицы (TransformMatrix * 3DPoint)
-// - Edge: связь между вершинами (не трансформируется напрямую, обновляется при трансформации вершин)
+// - Vertex: представление вершины по индексу в SoA хранилище Mesh (x/y/z float)
+// - Edge: пара индексов вершин (не трансформируется, индексы не меняются)
+// - Mesh: трансформация массивов координат пакетным SIMD ядром (transform_kernel)
 // - Figure: трансформация всех вершин фигуры (делегирует трансформацию каждой вершине)
 // - Scene: трансформация всех фигур в сцене (делегирует трансформацию каждой фигуре)
 // - SceneObject: абстрактный интерфейс для трансформируемых объектов
 
 
+#include "geometry.h"
+
+namespace s21 {
+
+// ====== TransformMatrix ======
+
+void TransformMatrix::ApplyToPoint(Point3D& point) const {
+    Vec3 result = matrix_.Transform(Vec3{point.x, point.y, point.z});
+    point = Point3D{result.x, result.y, result.z};
+}
+
+TransformMatrix TransformMatrix::Multiply(const TransformMatrix& other) const {
+    return TransformMatrix(matrix_ * other.matrix_);
+}
+
+// ====== TransformMatrixBuilder ======
+
+TransformMatrix TransformMatrixBuilder::CreateIdentityMatrix() {
+    return TransformMatrix(Mat4::Identity());
+}
+
+TransformMatrix TransformMatrixBuilder::CreateMoveMatrix(double dx, double dy, double dz) {
+    return TransformMatrix(Mat4::Translation(dx, dy, dz));
+}
+
 TransformMatrix TransformMatrixBuilder::CreateRotationMatrix(double angleX, double angleY, double angleZ) {
-    // Создаем матрицы поворота используя s21_matrix+
-    S21Matrix rotateX = createRotationXMatrix(angleX);
-    S21Matrix rotateY = createRotationYMatrix(angleY);
-    S21Matrix rotateZ = createRotationZMatrix(angleZ);
-    
-    // Комбинируем матрицы
-    S21Matrix result = rotateZ * rotateY * rotateX;
-    
-    return TransformMatrix(result);
+    // Rz * Ry * Rx в замкнутой форме: без промежуточных матриц и умножений
+    return TransformMatrix(Mat4::Rotation(angleX, angleY, angleZ));
 }
+
+TransformMatrix TransformMatrixBuilder::CreateScaleMatrix(double scaleX, double scaleY, double scaleZ) {
+    return TransformMatrix(Mat4::Scale(scaleX, scaleY, scaleZ));
+}
+
+}  // namespace s21
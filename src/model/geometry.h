@@ -6,37 +6,55 @@
 // трансформаций 3D объектов.
 //
 // ЧТО СОДЕРЖИТ:
-// - 3DPoint структура (x, y, z координаты) - базовая точка в 3D пространстве
-// - TransformMatrix класс (4x4 матрица для аффинных преобразований)
+// - Point3D структура (x, y, z координаты) - базовая точка в 3D пространстве
+// - TransformMatrix класс (4x4 матрица для аффинных преобразований) - адаптер над Mat4
 // - TransformMatrixBuilder класс (статические методы создания матриц поворота/перемещения/масштабирования)
+// - BoundingBox структура (ограничивающий параллелепипед, min/max по осям)
 //
 // КАК РАБОТАЕТ:
-// 1. 3DPoint хранит координаты точки в 3D пространстве
+// 1. Point3D хранит координаты точки в 3D пространстве
 // 2. TransformMatrix применяет аффинные преобразования к точкам
 // 3. TransformMatrixBuilder создает матрицы для разных типов трансформаций
-// 4. Матрицы применяются к 3DPoint через умножение
+// 4. Матрицы применяются к Point3D через умножение
+// 5. Вся математика - Mat4 (mat4.h) на стеке, без выделения памяти
 //
 // Все классы в namespace s21
 
+#ifndef GEOMETRY_H_
+#define GEOMETRY_H_
+
+#include "mat4.h"  // Mat4, Vec3, Vec4
+
 namespace s21 {
     // Базовые структуры
-    struct 3DPoint { double x, y, z; };
+    struct Point3D { double x, y, z; };
+    struct BoundingBox { Point3D min, max; };
     
     // Матрицы трансформации
     class TransformMatrix {
     private:
-        S21Matrix matrix_;  // ← Используем s21_matrix+
+        Mat4 matrix_ = Mat4::Identity();
         
     public:
-        // Обертка над s21_matrix+:
-        void ApplyToPoint(3DPoint& point);
-        TransformMatrix Multiply(const TransformMatrix& other);
+        constexpr TransformMatrix() = default;
+        constexpr explicit TransformMatrix(const Mat4& matrix) : matrix_(matrix) {}
+        
+        // Обертка над Mat4:
+        void ApplyToPoint(Point3D& point) const;
+        TransformMatrix Multiply(const TransformMatrix& other) const;
+        const Mat4& GetMat4() const { return matrix_; }
+        
+        // Копия в 16 float по строкам - для пакетных ядер (transform_kernel.h)
+        void ToFloatArray(float out[16]) const { matrix_.ToFloatArray(out); }
     };
     class TransformMatrixBuilder {
     public:
+        static TransformMatrix CreateIdentityMatrix();
         static TransformMatrix CreateMoveMatrix(double dx, double dy, double dz);
         static TransformMatrix CreateRotationMatrix(double angleX, double angleY, double angleZ);
         static TransformMatrix CreateScaleMatrix(double scaleX, double scaleY, double scaleZ);
     };
     
-}
+}  // namespace s21
+
+#endif  // GEOMETRY_H_
@@ -17,11 +17,15 @@
 // КАК РАБОТАЕТ:
 // 1. Открытие файла, проверка существования и доступности
 // 2. Чтение файла построчно, пропуск комментариев (#)
-// 3. Парсинг вершин: "v 1.0 2.0 3.0" -> создание Vertex с 3DPoint
+// 3. Парсинг вершин: "v 1.0 2.0 3.0" -> создание Vertex с Point3D
 // 4. Парсинг граней: "f 1 2 3" -> создание Edge между Vertex'ами
+//    (общее ребро соседних граней добавляется один раз, EdgeBuilder)
 // 5. Валидация: проверка индексов вершин, корректности координат
-// 6. Нормализация: вычисление центра масс, масштабирование до единичного размера
-// 7. Создание Mesh с вершинами и ребрами
+// 6. Нормализация: центр габаритного контейнера, масштабирование до targetSize
+//    (границы - параллельная SIMD редукция, затем одна матрица S * T
+//    применяется к массивам координат пакетным ядром - всего два прохода)
+// 7. Создание Mesh с вершинами и ребрами; грани триангулируются веером
+//    (a, b, c), (a, c, d)... и сохраняются в Mesh вместе с нормалями
 // 8. Создание Mesh с фигурой
 // 9. Возврат FacadeOperationResult (успех + Mesh или ошибка + сообщение)
 //
@@ -33,18 +37,459 @@
 //
 // ОПТИМИЗАЦИЯ:
 // - Потоковое чтение для больших файлов
+// - Режим kMapped: файл отображается в память (MappedFile) и разбирается
+//   кусками на всех ядрах (ObjParser), результат совпадает с kStream
 // - Предварительное выделение памяти по количеству строк
-// - Кэширование нормализованных моделей
-Mesh createMeshFromTempData() {
-    Mesh mesh;
+// - Грани хранятся в CSR виде (face_offsets + face_indices), без вектора на грань;
+//   временные буферы сохраняют емкость между загрузками, массивы координат
+//   переносятся в Mesh (повторная загрузка - единицы аллокаций, bench_loader)
+// - Кэширование нормализованных моделей (MeshCache, включается явно:
+//   бинарный файл в каталоге кэша, загрузка через отображение в память)
+// - VertexOrder::kMorton (по умолчанию): после построения ребер вершины
+//   переставляются по кривой Мортона, ребра сортируются по первой вершине
+//   (MeshReorderer) - проекция и отрисовка читают память почти подряд;
+//   замер до/после - GetLastReorderStats()
+// - Облако точек (файл без строк "f", сканы LiDAR): ребра и треугольники не
+//   строятся (EdgeBuilder не трогается), в Mesh - только массивы x, y, z,
+//   12 байт на точку; черновик загрузки - каждая k-я точка, не больше
+//   kPreviewPoints (копия всех точек удвоила бы память на время загрузки)
+//
+// ПРОФИЛИРОВАНИЕ (profiler.h, категория kLoad):
+// - "read" - весь ReadMesh; "read: cache" - попытка загрузки из кэша
+// - "read: io" - открытие/отображение файла
+// - "read: parse" - разбор kMapped (вершины и грани - один проход по куску);
+//   в kStream отдельно "read: parse vertices" и "read: parse faces"
+//   (сумма по строкам)
+// - "read: validate", "read: edges", "read: triangles", "read: reorder", "read: normalize",
+//   "read: cache store"
+
+#include "io.h"
+
+#include <algorithm>
+#include <fstream>
+
+#include "mapped_file.h"
+#include "profiler.h"
+
+namespace s21 {
+
+NormalizationParameters::NormalizationParameters(double targetSize, bool centerModel)
+    : targetSize_(targetSize), centerModel_(centerModel) {}
+
+FacadeOperationResult FileReader::ReadMesh(const std::string& filepath,
+                                           const NormalizationParameters& params) {
+    S21_PROFILE_SCOPE("read", kLoad);
+    // 0. Готовый Mesh из бинарного кэша (отображается в память без разбора)
+    Mesh cached;
+    if (cache_enabled_ && loadCached(filepath, params, cached)) {
+        return FacadeOperationResult(true, "Mesh loaded from cache", std::move(cached));
+    }
+    
+    clearTempData();
     
-    // Создаем Vertex'ы из temp_vertices_
-    for (const auto& point : temp_vertices_) {
-        mesh.AddVertex(point);
+    // 1-3. Разбор файла в temp_data_
+    FacadeOperationResult status = parse_mode_ == ParseMode::kMapped
+                                       ? readMapped(filepath)
+                                       : readStream(filepath);
+    return finishReading(filepath, params, std::move(status));
+}
+
+FacadeOperationResult FileReader::ReadMesh(const std::string& filepath,
+                                           const NormalizationParameters& params,
+                                           LoadObserver& observer) {
+    S21_PROFILE_SCOPE("read", kLoad);
+    Mesh cached;
+    if (cache_enabled_ && loadCached(filepath, params, cached)) {
+        LoadProgress progress;
+        progress.vertices = cached.GetVertexCount();
+        observer.OnProgress(progress);
+        return FacadeOperationResult(true, "Mesh loaded from cache", std::move(cached));
     }
     
-    // Создаем Edge'ы из temp_faces_
-    createEdgesFromFaces(mesh);
+    clearTempData();
+    FacadeOperationResult status = readProgressive(filepath, params, observer);
+    return finishReading(filepath, params, std::move(status), &observer);
+}
+
+// Фазы после разбора идут секундами на больших моделях: отмена проверяется
+// между ними, иначе новая загрузка ждет (Model::LoadMeshAsync) конца старой
+FacadeOperationResult FileReader::finishReading(const std::string& filepath,
+                                                const NormalizationParameters& params,
+                                                FacadeOperationResult status,
+                                                const LoadObserver* observer) {
+    // Временные данные очищаются на любом выходе: ошибка, отмена, пустой файл
+    struct TempDataGuard {
+        FileReader& reader;
+        ~TempDataGuard() { reader.clearTempData(); }
+    } tempGuard{*this};
+    
+    auto cancelled = [&] { return observer && observer->IsCancelled(); };
+    const FacadeOperationResult cancelledResult(false, kLoadCancelledMessage);
+    last_reorder_ = ReorderStats();
+    if (status.IsError()) return status;
+    if (temp_data_.GetVertexCount() == 0) {
+        return FacadeOperationResult(false, "File is empty or contains no geometry");
+    }
+    
+    // Валидация индексов (относительные уже разрешены в абсолютные)
+    {
+        S21_PROFILE_SCOPE("read: validate", kLoad);
+        size_t vertexCount = temp_data_.GetVertexCount();
+        for (int index : temp_data_.face_indices) {
+            if (!isValidVertexIndex(index, vertexCount)) {
+                return FacadeOperationResult(false, "Corrupted data: invalid vertex index");
+            }
+        }
+    }
+    
+    if (cancelled()) return cancelledResult;
+    
+    // 4-7. Mesh (+ порядок вершин для кэша процессора) + нормализация
+    Mesh mesh = createMeshFromTempData(observer);
+    clearTempData();  // Грани больше не нужны - до перестановки и нормализации
+    if (cancelled()) return cancelledResult;
+    if (vertex_order_ == VertexOrder::kMorton) last_reorder_ = reorderer_.Reorder(mesh);
+    if (cancelled()) return cancelledResult;
+    normalizeMesh(mesh, params);
+    if (cancelled()) return cancelledResult;
+    
+    // Ошибка записи кэша не влияет на результат загрузки
+    if (cache_enabled_) {
+        S21_PROFILE_SCOPE("read: cache store", kLoad);
+        mesh_cache_.Store(filepath, params, mesh, vertex_order_);
+    }
+    if (cancelled()) return cancelledResult;
+    compactMesh(mesh);
+    
+    return FacadeOperationResult(true, "Mesh loaded successfully", std::move(mesh));
+}
+
+bool FileReader::loadCached(const std::string& filepath, const NormalizationParameters& params,
+                            Mesh& mesh) {
+    S21_PROFILE_SCOPE("read: cache", kLoad);
+    last_reorder_ = ReorderStats();
+    if (!mesh_cache_.Load(filepath, params, mesh, vertex_order_)) return false;
+    compactMesh(mesh);
+    return true;
+}
+
+void FileReader::compactMesh(Mesh& mesh) const {
+    if (vertex_precision_ == VertexPrecision::kFloat) return;
+    S21_PROFILE_SCOPE("read: compact", kLoad);
+    mesh.SetVertexPrecision(vertex_precision_);
+}
+
+FacadeOperationResult FileReader::readStream(const std::string& filepath) {
+    std::ifstream file;
+    {
+        S21_PROFILE_SCOPE("read: io", kLoad);
+        file.open(filepath);
+    }
+    if (!file.is_open()) {
+        return FacadeOperationResult(false, "File not found: " + filepath);
+    }
+    
+    ProfileAccumulator vertexTime("read: parse vertices", ProfileCategory::kLoad);
+    ProfileAccumulator faceTime("read: parse faces", ProfileCategory::kLoad);
+    std::string line;
+    size_t lineNumber = 0;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        std::replace(line.begin(), line.end(), '\t', ' ');
+        std::replace(line.begin(), line.end(), '\r', ' ');
+        
+        std::vector<std::string> tokens = splitString(line, ' ');
+        if (tokens.empty() || tokens[0][0] == '#') continue;
+        
+        bool parsed = true;
+        if (tokens[0] == "v") {
+            vertexTime.Begin();
+            Point3D point;
+            parsed = parseVertex(line, point);
+            if (parsed) {
+                temp_data_.x.push_back(static_cast<float>(point.x));
+                temp_data_.y.push_back(static_cast<float>(point.y));
+                temp_data_.z.push_back(static_cast<float>(point.z));
+            }
+            vertexTime.End();
+        } else if (tokens[0] == "f") {
+            faceTime.Begin();
+            temp_face_.clear();
+            parsed = parseFace(line, temp_face_);
+            if (parsed) {
+                temp_data_.face_indices.insert(temp_data_.face_indices.end(),
+                                               temp_face_.begin(), temp_face_.end());
+                temp_data_.EndFace();
+            }
+            faceTime.End();
+        }
+        if (!parsed) {
+            return FacadeOperationResult(false, "Invalid OBJ format at line " +
+                                                    std::to_string(lineNumber));
+        }
+    }
+    return FacadeOperationResult(true, "");
+}
+
+FacadeOperationResult FileReader::readMapped(const std::string& filepath) {
+    MappedFile file;
+    bool opened;
+    {
+        S21_PROFILE_SCOPE("read: io", kLoad);
+        opened = file.Open(filepath);
+    }
+    if (!opened) {
+        return FacadeOperationResult(false, "File not found: " + filepath);
+    }
+    
+    // Вершины и грани дописываются прямо в temp_data_
+    bool parsed;
+    {
+        S21_PROFILE_SCOPE("read: parse", kLoad);
+        parsed = obj_parser_.Parse(file.GetData(), file.GetSize(), temp_data_);
+    }
+    if (!parsed) {
+        return FacadeOperationResult(false, "Invalid OBJ format at line " +
+                                                std::to_string(temp_data_.error_line));
+    }
+    if (temp_data_.has_zero_index) {
+        return FacadeOperationResult(false, "Corrupted data: invalid vertex index");
+    }
+    return FacadeOperationResult(true, "");
+}
+
+FacadeOperationResult FileReader::readProgressive(const std::string& filepath,
+                                                  const NormalizationParameters& params,
+                                                  LoadObserver& observer) {
+    // Первый кусок маленький (быстрый первый кадр), дальше размер удваивается
+    constexpr size_t kFirstSliceBytes = 256u << 10;
+    constexpr size_t kMaxSliceBytes = 64u << 20;
+    
+    MappedFile file;
+    bool opened;
+    {
+        S21_PROFILE_SCOPE("read: io", kLoad);
+        opened = file.Open(filepath);
+    }
+    if (!opened) {
+        return FacadeOperationResult(false, "File not found: " + filepath);
+    }
+    const char* data = file.GetData();
+    size_t size = file.GetSize();
+    
+    LoadProgress progress;
+    progress.total_bytes = size;
+    preview_edge_builder_.Begin(0);
+    size_t previewFaces = 0;       // Грани, уже переданные preview_edge_builder_
+    size_t nextPreview = 0;        // Порог числа вершин для следующего чернового Mesh
+    
+    ProfileAccumulator parseTime("read: parse", ProfileCategory::kLoad);  // Сумма по кускам
+    size_t offset = 0;
+    size_t sliceSize = kFirstSliceBytes;
+    while (offset < size) {
+        if (observer.IsCancelled()) {
+            return FacadeOperationResult(false, kLoadCancelledMessage);
+        }
+        
+        // Кусок до ближайшего конца строки
+        size_t end = std::min(size, offset + sliceSize);
+        const char* newline = std::find(data + end - 1, data + size, '\n');
+        end = newline == data + size ? size : static_cast<size_t>(newline - data) + 1;
+        
+        parseTime.Begin();
+        bool parsed = obj_parser_.Parse(data + offset, end - offset, temp_data_);
+        parseTime.End();
+        if (!parsed) {
+            size_t before = std::count(data, data + offset, '\n');
+            return FacadeOperationResult(false, "Invalid OBJ format at line " +
+                                                    std::to_string(before + temp_data_.error_line));
+        }
+        if (temp_data_.has_zero_index) {
+            return FacadeOperationResult(false, "Corrupted data: invalid vertex index");
+        }
+        
+        progress.bytes_read = end;
+        progress.vertices = temp_data_.GetVertexCount();
+        progress.faces = temp_data_.GetFaceCount();
+        observer.OnProgress(progress);
+        
+        if (progress.vertices >= nextPreview && end < size) {
+            observer.OnPartialMesh(createPreviewMesh(previewFaces, params), progress);
+            nextPreview = std::max(preview_batch_, progress.vertices * 2);
+            previewFaces = progress.faces;
+        }
+        
+        offset = end;
+        sliceSize = std::min(sliceSize * 2, kMaxSliceBytes);
+    }
+    return FacadeOperationResult(true, "");
+}
+
+Mesh FileReader::createPreviewMesh(size_t firstNewFace, const NormalizationParameters& params) {
+    // Черновику нужна своя копия координат: temp_data_ продолжает расти.
+    // Копия не больше kPreviewPoints вершин - иначе пик памяти загрузки
+    // рос бы вместе с файлом
+    const ObjParseResult& data = temp_data_;
+    Mesh preview;
+    if (data.GetVertexCount() > kPreviewPoints) {
+        // Равномерная выборка точек без ребер (и для облака, и для mesh'а);
+        // preview_edge_builder_ дальше не растет - вершин уже больше порога
+        size_t stride = (data.GetVertexCount() + kPreviewPoints - 1) / kPreviewPoints;
+        std::vector<float> x, y, z;
+        x.reserve(kPreviewPoints), y.reserve(kPreviewPoints), z.reserve(kPreviewPoints);
+        for (size_t i = 0; i < data.GetVertexCount(); i += stride) {
+            x.push_back(data.x[i]);
+            y.push_back(data.y[i]);
+            z.push_back(data.z[i]);
+        }
+        preview.SetPositions(std::move(x), std::move(y), std::move(z));
+        normalizeMesh(preview, params);
+        return preview;
+    }
+    
+    // Грани, ссылающиеся на еще не прочитанные вершины, в черновик не попадают
+    for (size_t f = firstNewFace; f < data.GetFaceCount(); ++f) {
+        const int* face = data.face_indices.data() + data.face_offsets[f];
+        size_t count = data.face_offsets[f + 1] - data.face_offsets[f];
+        bool valid = std::all_of(face, face + count, [this, &data](int index) {
+            return isValidVertexIndex(index, data.GetVertexCount());
+        });
+        if (valid) preview_edge_builder_.AddFace(face, count);
+    }
+    preview.SetPositions(std::vector<float>(data.x), std::vector<float>(data.y),
+                         std::vector<float>(data.z));
+    std::span<const uint32_t> edges = preview_edge_builder_.GetEdges();
+    preview.SetEdges(std::vector<uint32_t>(edges.begin(), edges.end()));
+    normalizeMesh(preview, params);
+    return preview;
+}
+
+bool FileReader::parseVertex(const std::string& line, Point3D& point) {
+    std::vector<std::string> tokens = splitString(line, ' ');
+    if (tokens.size() < 4) return false;
+    
+    double* coords[3] = {&point.x, &point.y, &point.z};
+    for (int i = 0; i < 3; ++i) {
+        const std::string& token = tokens[i + 1];
+        if (!ParseObjDouble(token.data(), token.data() + token.size(), *coords[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FileReader::parseFace(const std::string& line, std::vector<int>& indices) {
+    std::vector<std::string> tokens = splitString(line, ' ');
+    if (tokens.size() < 4) return false;
+    
+    int vertexCount = static_cast<int>(temp_data_.GetVertexCount());
+    for (size_t i = 1; i < tokens.size(); ++i) {
+        int raw = 0;
+        if (!ParseObjIndex(tokens[i].data(), tokens[i].data() + tokens[i].size(), raw)) {
+            return false;
+        }
+        // 1-based -> 0-based, отрицательные - относительно текущего числа вершин
+        indices.push_back(raw > 0 ? raw - 1 : (raw < 0 ? vertexCount + raw : -1));
+    }
+    return true;
+}
+
+std::vector<std::string> FileReader::splitString(const std::string& str, char delimiter) {
+    std::vector<std::string> tokens;
+    size_t start = 0;
+    while (start < str.size()) {
+        size_t end = str.find(delimiter, start);
+        if (end == std::string::npos) end = str.size();
+        if (end > start) tokens.emplace_back(str, start, end - start);
+        start = end + 1;
+    }
+    return tokens;
+}
+
+bool FileReader::isValidVertexIndex(int index, size_t vertexCount) {
+    return index >= 0 && static_cast<size_t>(index) < vertexCount;
+}
+
+void FileReader::clearTempData() {
+    temp_data_.Clear();
+    temp_face_.clear();
+}
+
+void FileReader::normalizeMesh(Mesh& mesh, const NormalizationParameters& params) {
+    if (mesh.GetVertexCount() == 0) return;
+    S21_PROFILE_SCOPE("read: normalize", kLoad);
+    
+    // 1. Границы: один проход, SIMD min/max по блокам на всех ядрах
+    BoundingBox bounds = mesh.ComputeBounds();
+    double extent = std::max({bounds.max.x - bounds.min.x,
+                              bounds.max.y - bounds.min.y,
+                              bounds.max.z - bounds.min.z});
+    double scale = extent > 0.0 ? params.GetTargetSize() / extent : 1.0;
+    
+    Point3D center{0.0, 0.0, 0.0};
+    if (params.ShouldCenterModel()) {
+        center = Point3D{(bounds.min.x + bounds.max.x) * 0.5,
+                         (bounds.min.y + bounds.max.y) * 0.5,
+                         (bounds.min.z + bounds.max.z) * 0.5};
+    }
+    
+    // 2. Центрирование и масштаб одной матрицей: p' = s * (p - c), один проход
+    Mat4 normalization = Mat4::Scale(scale, scale, scale) *
+                         Mat4::Translation(-center.x, -center.y, -center.z);
+    mesh.Transform(TransformMatrix(normalization));
+}
+
+Mesh FileReader::createMeshFromTempData(const LoadObserver* observer) {
+    Mesh mesh;
+    
+    // Облако точек: без граней нет ни ребер, ни треугольников
+    const bool pointCloud = temp_data_.GetFaceCount() == 0;
+    
+    // Создаем Edge'ы из граней (до переноса координат - нужен только CSR)
+    if (!pointCloud) createEdgesFromFaces(mesh, observer);
+    
+    // Координаты переносятся в Mesh без копирования
+    mesh.SetPositions(std::move(temp_data_.x), std::move(temp_data_.y), std::move(temp_data_.z));
+    
+    // Треугольники граней и их нормали (нужны координаты)
+    if (!pointCloud && !(observer && observer->IsCancelled())) createTrianglesFromFaces(mesh);
     
     return mesh;
-}
\ No newline at end of file
+}
+
+void FileReader::createTrianglesFromFaces(Mesh& mesh) {
+    S21_PROFILE_SCOPE("read: triangles", kLoad);
+    const ObjParseResult& data = temp_data_;
+    size_t count = 0;
+    for (size_t f = 0; f < data.GetFaceCount(); ++f) {
+        size_t corners = data.face_offsets[f + 1] - data.face_offsets[f];
+        if (corners >= 3) count += corners - 2;
+    }
+    std::vector<uint32_t> triangles;
+    triangles.reserve(count * 3);
+    // Веер от первой вершины грани; треугольник с повторной вершиной отбрасывается
+    for (size_t f = 0; f < data.GetFaceCount(); ++f) {
+        const int* face = data.face_indices.data() + data.face_offsets[f];
+        size_t corners = data.face_offsets[f + 1] - data.face_offsets[f];
+        for (size_t i = 1; i + 1 < corners; ++i) {
+            uint32_t a = uint32_t(face[0]), b = uint32_t(face[i]), c = uint32_t(face[i + 1]);
+            if (a == b || b == c || a == c) continue;
+            triangles.insert(triangles.end(), {a, b, c});
+        }
+    }
+    mesh.SetTriangles(std::move(triangles));
+}
+
+void FileReader::createEdgesFromFaces(Mesh& mesh, const LoadObserver* observer) {
+    S21_PROFILE_SCOPE("read: edges", kLoad);
+    const ObjParseResult& data = temp_data_;
+    edge_builder_.Begin(data.face_indices.size());
+    for (size_t f = 0; f < data.GetFaceCount(); ++f) {
+        if (observer && f % kCancelCheckFaces == 0 && observer->IsCancelled()) break;
+        edge_builder_.AddFace(data.face_indices.data() + data.face_offsets[f],
+                              data.face_offsets[f + 1] - data.face_offsets[f]);
+    }
+    mesh.SetEdges(edge_builder_.TakeEdges());
+}
+
+}  // namespace s21
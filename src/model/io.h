@@ -19,8 +19,12 @@
 
 #include <string>
 #include <vector>
-#include "geometry.h"  // 3DPoint, TransformMatrix
+#include "geometry.h"  // Point3D, TransformMatrix
 #include "model.h"     // Mesh, Vertex, Edge
+#include "obj_parser.h"  // ObjParser (параллельный разбор из памяти)
+#include "edge_builder.h"  // EdgeBuilder (уникальные ребра)
+#include "mesh_cache.h"    // MeshCache (бинарный кэш моделей)
+#include "mesh_reorder.h"  // MeshReorderer (порядок вершин для кэша процессора)
 
 namespace s21 {
 
@@ -46,39 +50,139 @@ private:
     bool centerModel_;     // Центрировать модель в (0,0,0)
 };
 
+// ====== Прогрессивная загрузка ======
+inline constexpr const char* kLoadCancelledMessage = "Loading cancelled";
+
+// Состояние загрузки, публикуется после каждого прочитанного куска файла
+struct LoadProgress {
+    uint64_t bytes_read = 0;
+    uint64_t total_bytes = 0;
+    size_t vertices = 0;
+    size_t faces = 0;
+};
+
+// Наблюдатель загрузки. Методы вызываются в потоке, где идет ReadMesh
+// (обычно рабочий поток MeshLoadTask), и не должны блокировать надолго.
+class LoadObserver {
+public:
+    virtual ~LoadObserver() = default;
+    virtual bool IsCancelled() const = 0;                  // Проверяется между кусками
+    virtual void OnProgress(const LoadProgress& progress) = 0;
+    virtual void OnPartialMesh(Mesh preview, const LoadProgress& progress) = 0;
+};
+
 // ====== Чтение OBJ файлов ======
 class FileReader {
 public:
+    // Режим разбора файла
+    enum class ParseMode {
+        kStream,   // std::ifstream + построчный разбор (запасной вариант)
+        kMapped    // mmap + параллельный разбор кусков через ObjParser
+    };
+
     FacadeOperationResult ReadMesh(const std::string& filepath, 
                                    const NormalizationParameters& params);
     
+    // Прогрессивная загрузка: файл читается кусками растущего размера, после
+    // каждого куска - OnProgress, по мере роста числа вершин - OnPartialMesh
+    // (нормализованный черновой Mesh, не больше kPreviewPoints вершин). Отмена -> kLoadCancelledMessage;
+    // проверяется и после разбора: между фазами (ребра, треугольники,
+    // перестановка, нормализация, запись кэша, сжатие) и внутри построения ребер
+    FacadeOperationResult ReadMesh(const std::string& filepath,
+                                   const NormalizationParameters& params,
+                                   LoadObserver& observer);
+    
+    // Черновик - не больше стольких вершин: у файла больше - равномерная
+    // выборка точек без ребер (для облака точек и для mesh'а)
+    static constexpr size_t kPreviewPoints = 1u << 20;
+    static constexpr size_t kCancelCheckFaces = 1u << 16;  // Граней между проверками отмены
+    
+    // Черновой Mesh публикуется при 1-м куске и далее при удвоении числа вершин
+    void SetPreviewBatch(size_t vertices) { preview_batch_ = vertices; }
+    
+    void SetParseMode(ParseMode mode) { parse_mode_ = mode; }
+    ParseMode GetParseMode() const { return parse_mode_; }
+    
+    // Бинарный кэш: повторная загрузка того же файла без разбора. По умолчанию
+    // выключен - без каталога (SetCacheDirectory) файл кэша пишется рядом с исходником
+    void SetCacheEnabled(bool enabled) { cache_enabled_ = enabled; }
+    bool IsCacheEnabled() const { return cache_enabled_; }
+    void SetCacheDirectory(const std::string& directory) { mesh_cache_.SetCacheDirectory(directory); }
+    
+    // Перестановка вершин по кривой Мортона после разбора (mesh_reorder.h)
+    void SetVertexOrder(VertexOrder order) { vertex_order_ = order; }
+    VertexOrder GetVertexOrder() const { return vertex_order_; }
+    // Результат последней загрузки; applied = false после кэша и малых моделей
+    const ReorderStats& GetLastReorderStats() const { return last_reorder_; }
+    
+    // Сжатое хранение координат и ребер загруженного Mesh (mesh_codec.h);
+    // кэш при этом пишется и читается во float
+    void SetVertexPrecision(VertexPrecision precision) { vertex_precision_ = precision; }
+    VertexPrecision GetVertexPrecision() const { return vertex_precision_; }
+    
     // 1. Открытие файла
-    // 2. Парсинг вершин (v x y z) -> temp_vertices_
-    // 3. Парсинг граней (f v1 v2 v3 ...) -> temp_faces_
-    // 4. Создание Vertex объектов из temp_vertices_
-    // 5. Создание Edge объектов из temp_faces_
-    // 6. Создание Mesh с Vertex и Edge
+    // 2. Парсинг вершин (v x y z) -> temp_data_.x/y/z
+    // 3. Парсинг граней (f v1 v2 v3 ...) -> temp_data_ (CSR: face_offsets + face_indices)
+    // 4. Массивы координат переносятся (move) в Mesh без копирования
+    // 5. Создание Edge объектов из граней (EdgeBuilder), треугольники граней
+    //    (веер) и их нормали; у облака точек (граней нет) шаг пропускается
+    // 6. Создание Mesh с Vertex и Edge (+ перестановка, если VertexOrder::kMorton)
     // 7. Нормализация mesh'а
-    // 8. Возврат результата
+    // 8. Возврат результата (сжатие, если точность не kFloat)
+    // (0. Если есть действительный кэш - Mesh берется из него, шаги 1-7 пропускаются;
+    //  после шага 7 кэш записывается)
 
 private:
-    // Временные контейнеры для парсинга
-    std::vector<3DPoint> temp_vertices_;           // Сырые координаты из OBJ
-    std::vector<std::vector<int>> temp_faces_;     // Индексы граней из OBJ
+    ParseMode parse_mode_ = ParseMode::kMapped;
+    ObjParser obj_parser_;  // Хранит буферы кусков между загрузками
+    EdgeBuilder edge_builder_;  // Хранит хэш-таблицу ребер между загрузками
+    MeshCache mesh_cache_;
+    bool cache_enabled_ = false;
+    MeshReorderer reorderer_;  // Хранит буферы сортировки между загрузками
+    VertexOrder vertex_order_ = VertexOrder::kMorton;
+    ReorderStats last_reorder_;
+    VertexPrecision vertex_precision_ = VertexPrecision::kFloat;
+    size_t preview_batch_ = 1u << 18;
+    EdgeBuilder preview_edge_builder_;  // Ребра черновых Mesh (растут вместе с файлом)
+    
+    // Временные контейнеры для парсинга: память сохраняется между загрузками,
+    // кроме массивов координат, которые уходят в Mesh
+    ObjParseResult temp_data_;          // Вершины (x, y, z) и грани в CSR виде (0-based)
+    std::vector<int> temp_face_;        // Индексы одной грани (построчный режим)
+    
+    bool loadCached(const std::string& filepath, const NormalizationParameters& params, Mesh& mesh);
+    void compactMesh(Mesh& mesh) const;
+    
+    // Заполнение temp_data_ в выбранном режиме
+    FacadeOperationResult readStream(const std::string& filepath);
+    FacadeOperationResult readMapped(const std::string& filepath);
+    FacadeOperationResult readProgressive(const std::string& filepath,
+                                          const NormalizationParameters& params,
+                                          LoadObserver& observer);
+    // observer - отмена между фазами (nullptr - без отмены)
+    FacadeOperationResult finishReading(const std::string& filepath,
+                                        const NormalizationParameters& params,
+                                        FacadeOperationResult status,
+                                        const LoadObserver* observer = nullptr);
+    Mesh createPreviewMesh(size_t firstNewFace, const NormalizationParameters& params);
     
     // Вспомогательные методы парсинга OBJ
-    bool parseVertex(const std::string& line, 3DPoint& point); // Парсит "v x y z" -> 3DPoint
+    bool parseVertex(const std::string& line, Point3D& point); // Парсит "v x y z" -> Point3D
     bool parseFace(const std::string& line, std::vector<int>& indices); // Парсит "f v1 v2 v3" -> индексы
     void normalizeMesh(Mesh& mesh, const NormalizationParameters& params); // Нормализует mesh
     
     // Создание финальных структур
-    Mesh createMeshFromTempData(); // Создает Mesh из temp_vertices_ и temp_faces_
-    void createEdgesFromFaces(Mesh& mesh); // Преобразует Face'ы (грани) в Edge'ы (ребра)
+    // Создает Mesh из temp_data_ (координаты переносятся); после отмены
+    // (observer) Mesh неполный - finishReading его выбрасывает
+    Mesh createMeshFromTempData(const LoadObserver* observer = nullptr);
+    // Преобразует Face'ы (грани) в уникальные Edge'ы (ребра); отмена - каждые kCancelCheckFaces граней
+    void createEdgesFromFaces(Mesh& mesh, const LoadObserver* observer = nullptr);
+    void createTrianglesFromFaces(Mesh& mesh); // Грани -> треугольники (веер) и нормали граней
     
     // Вспомогательные методы
     std::vector<std::string> splitString(const std::string& str, char delimiter);
     bool isValidVertexIndex(int index, size_t vertexCount);
-    void clearTempData(); // Очищает временные контейнеры
+    void clearTempData(); // Очищает временные контейнеры (емкость сохраняется)
 };
 
 }  // namespace s21
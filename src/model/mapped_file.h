@@ -0,0 +1,55 @@
+// MAPPED_FILE.H - Отображение файла в память (memory-mapped file)
+//
+// ЗАЧЕМ НУЖЕН:
+// OBJ файлы сканов занимают несколько гигабайт. Построчное чтение через
+// std::ifstream копирует каждую строку в std::string. Отображение файла
+// в память дает парсеру прямой доступ к байтам файла без копирования.
+//
+// ЧТО СОДЕРЖИТ:
+// - MappedFile класс (RAII обертка над mmap / MapViewOfFile) - только чтение
+//
+// КАК РАБОТАЕТ:
+// 1. Open() открывает файл и отображает его целиком в память
+// 2. GetData()/GetSize() дают доступ к содержимому
+// 3. Деструктор (или Close()) снимает отображение и закрывает файл
+//
+// Все в namespace s21
+
+#ifndef MAPPED_FILE_H_
+#define MAPPED_FILE_H_
+
+#include <cstddef>
+#include <string>
+
+namespace s21 {
+
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    bool Open(const std::string& path); // false если файл не найден или не отображается
+    void Close();
+
+    bool IsOpen() const { return data_ != nullptr || opened_empty_; }
+    const char* GetData() const { return data_; }
+    size_t GetSize() const { return size_; }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    bool opened_empty_ = false;  // Пустой файл нельзя отобразить, но он корректен
+#ifdef _WIN32
+    void* file_handle_ = nullptr;
+    void* mapping_handle_ = nullptr;
+#endif
+};
+
+}  // namespace s21
+
+#endif  // MAPPED_FILE_H_
@@ -0,0 +1,132 @@
+// MAT4.H - Матрицы и векторы фиксированного размера (на стеке, constexpr)
+//
+// ЗАЧЕМ НУЖЕН:
+// S21Matrix - матрица произвольного размера в куче. Для аффинных
+// преобразований всегда нужна 4x4, а построение поворота через три
+// S21Matrix и два умножения выделяло память несколько раз на каждое
+// движение мыши. Mat4/Vec3/Vec4 - значения на стеке без аллокаций,
+// которые компилятор разворачивает в линейный код.
+//
+// ЧТО СОДЕРЖИТ:
+// - Vec3, Vec4 структуры (double)
+// - Mat4 структура (4x4, хранение по строкам, row-major)
+// - Построители: Identity, Translation, Scale, RotationX/Y/Z,
+//   Rotation (Rz * Ry * Rx в замкнутой форме), FromSinCos для constexpr
+// - Умножение матриц, применение к точке (Transform) и к вектору (Vec4)
+//
+// КАК РАБОТАЕТ:
+// 1. Все операции constexpr, кроме построителей поворота от углов
+//    (std::sin/std::cos не constexpr в C++20) - они считают синусы
+//    и вызывают constexpr RotationFromSinCos
+// 2. Углы в радианах
+// 3. TransformMatrix (geometry.h) - тонкий адаптер над Mat4
+//
+// Все в namespace s21
+
+#ifndef MAT4_H_
+#define MAT4_H_
+
+#include <cmath>
+
+namespace s21 {
+
+struct Vec3 {
+    double x = 0.0, y = 0.0, z = 0.0;
+
+    constexpr bool operator==(const Vec3&) const = default;
+};
+
+struct Vec4 {
+    double x = 0.0, y = 0.0, z = 0.0, w = 0.0;
+
+    constexpr bool operator==(const Vec4&) const = default;
+};
+
+struct Mat4 {
+    double m[16] = {};  // m[row * 4 + col]
+
+    constexpr double operator()(int row, int col) const { return m[row * 4 + col]; }
+    constexpr double& operator()(int row, int col) { return m[row * 4 + col]; }
+    constexpr bool operator==(const Mat4&) const = default;
+
+    // ====== Построители ======
+    static constexpr Mat4 Identity() {
+        return Mat4{{1, 0, 0, 0,
+                     0, 1, 0, 0,
+                     0, 0, 1, 0,
+                     0, 0, 0, 1}};
+    }
+
+    static constexpr Mat4 Translation(double dx, double dy, double dz) {
+        return Mat4{{1, 0, 0, dx,
+                     0, 1, 0, dy,
+                     0, 0, 1, dz,
+                     0, 0, 0, 1}};
+    }
+
+    static constexpr Mat4 Scale(double sx, double sy, double sz) {
+        return Mat4{{sx, 0, 0, 0,
+                     0, sy, 0, 0,
+                     0, 0, sz, 0,
+                     0, 0, 0, 1}};
+    }
+
+    // Rz * Ry * Rx по готовым синусам/косинусам (без умножения матриц)
+    static constexpr Mat4 RotationFromSinCos(double sx, double cx, double sy, double cy,
+                                             double sz, double cz) {
+        return Mat4{{cz * cy, cz * sy * sx - sz * cx, cz * sy * cx + sz * sx, 0,
+                     sz * cy, sz * sy * sx + cz * cx, sz * sy * cx - cz * sx, 0,
+                     -sy,     cy * sx,                cy * cx,                0,
+                     0,       0,                      0,                      1}};
+    }
+
+    static Mat4 Rotation(double angleX, double angleY, double angleZ) {
+        return RotationFromSinCos(std::sin(angleX), std::cos(angleX), std::sin(angleY),
+                                  std::cos(angleY), std::sin(angleZ), std::cos(angleZ));
+    }
+
+    static Mat4 RotationX(double angle) { return Rotation(angle, 0.0, 0.0); }
+    static Mat4 RotationY(double angle) { return Rotation(0.0, angle, 0.0); }
+    static Mat4 RotationZ(double angle) { return Rotation(0.0, 0.0, angle); }
+
+    // ====== Операции ======
+    constexpr Mat4 operator*(const Mat4& other) const {
+        Mat4 result;
+        for (int row = 0; row < 4; ++row) {
+            for (int col = 0; col < 4; ++col) {
+                double sum = 0.0;
+                for (int k = 0; k < 4; ++k) sum += (*this)(row, k) * other(k, col);
+                result(row, col) = sum;
+            }
+        }
+        return result;
+    }
+
+    constexpr Vec4 operator*(const Vec4& v) const {
+        return Vec4{m[0] * v.x + m[1] * v.y + m[2] * v.z + m[3] * v.w,
+                    m[4] * v.x + m[5] * v.y + m[6] * v.z + m[7] * v.w,
+                    m[8] * v.x + m[9] * v.y + m[10] * v.z + m[11] * v.w,
+                    m[12] * v.x + m[13] * v.y + m[14] * v.z + m[15] * v.w};
+    }
+
+    // Аффинное применение к точке (w = 1, нижняя строка не используется)
+    constexpr Vec3 Transform(const Vec3& p) const {
+        return Vec3{m[0] * p.x + m[1] * p.y + m[2] * p.z + m[3],
+                    m[4] * p.x + m[5] * p.y + m[6] * p.z + m[7],
+                    m[8] * p.x + m[9] * p.y + m[10] * p.z + m[11]};
+    }
+
+    // Копия в float по строкам - для пакетного ядра TransformPositions
+    constexpr void ToFloatArray(float out[16]) const {
+        for (int i = 0; i < 16; ++i) out[i] = static_cast<float>(m[i]);
+    }
+};
+
+// Проверки на этапе компиляции: построители и умножение вычислимы constexpr
+static_assert(Mat4::Identity() * Mat4::Scale(2, 3, 4) == Mat4::Scale(2, 3, 4));
+static_assert(Mat4::Translation(1, 2, 3).Transform(Vec3{1, 1, 1}) == Vec3{2, 3, 4});
+static_assert(Mat4::RotationFromSinCos(0, 1, 0, 1, 0, 1) == Mat4::Identity());
+
+}  // namespace s21
+
+#endif  // MAT4_H_
@@ -0,0 +1,274 @@
+// MESH_CACHE.CPP - Реализация бинарного кэша моделей
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - Ключ кэша: абсолютный путь + размер + mtime исходника + NormalizationParameters
+// - Запись: заголовок, путь, выровненные секции координат, ребер,
+//   треугольников и нормалей граней
+// - Загрузка: MappedFile + проверки заголовка и границ секций (без
+//   переполнения), индексы ребер и треугольников < числа вершин,
+//   Mesh::AdoptExternal без копирования данных
+// - Запись во временный файл со своим именем у каждого писателя
+//
+// Ошибки чтения/записи кэша не считаются ошибками загрузки модели:
+// Load() возвращает false (промах), FileReader разбирает OBJ как обычно.
+
+#include "mesh_cache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <span>
+#include <thread>
+
+#include "io.h"            // NormalizationParameters
+#include "mapped_file.h"
+#include "model.h"         // Mesh
+
+namespace s21 {
+
+namespace {
+
+namespace fs = std::filesystem;
+
+constexpr char kMagic[4] = {'S', '2', '1', 'M'};
+constexpr uint32_t kByteOrderTag = 0x01020304;
+constexpr uint64_t kSectionAlignment = 64;
+
+struct MeshCacheHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t path_length;
+    uint64_t source_size;
+    int64_t source_mtime;
+    double target_size;
+    uint32_t center_model;
+    uint32_t vertex_order;    // VertexOrder
+    uint64_t vertex_count;
+    uint64_t edge_count;
+    uint64_t triangle_count;
+    uint64_t positions_offset;
+    uint64_t edges_offset;
+    uint64_t triangles_offset;
+    uint64_t normals_offset;
+    uint64_t file_size;
+};
+
+struct SourceKey {
+    std::string path;
+    uint64_t size = 0;
+    int64_t mtime = 0;
+};
+
+bool readSourceKey(const std::string& sourcePath, SourceKey& key) {
+    std::error_code ec;
+    fs::path absolute = fs::absolute(sourcePath, ec);
+    if (ec) return false;
+    key.path = absolute.lexically_normal().string();
+    key.size = fs::file_size(absolute, ec);
+    if (ec) return false;
+    key.mtime = static_cast<int64_t>(fs::last_write_time(absolute, ec).time_since_epoch().count());
+    return !ec;
+}
+
+uint64_t alignUp(uint64_t value) {
+    return (value + kSectionAlignment - 1) / kSectionAlignment * kSectionAlignment;
+}
+
+// FNV-1a: стабильный между запусками и компиляторами (в отличие от std::hash)
+uint64_t hashPath(const std::string& path) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (unsigned char c : path) {
+        hash ^= c;
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+// Секция [offset, offset + count * elementSize) внутри файла; без
+// переполнения при любых значениях из заголовка
+bool sectionFits(uint64_t offset, uint64_t count, uint64_t elementSize, uint64_t fileSize) {
+    if (offset % kSectionAlignment != 0 || offset > fileSize) return false;
+    return count <= (fileSize - offset) / elementSize;
+}
+
+// Индексы из файла не проверялись при записи чужой программой или после
+// повреждения: индекс >= count - выход за массивы координат при отрисовке
+bool indicesInRange(std::span<const uint32_t> indices, uint64_t count) {
+    uint32_t top = 0;
+    for (uint32_t index : indices) top = std::max(top, index);  // Без ветвлений, векторизуется
+    return indices.empty() || top < count;
+}
+
+// Свое имя у каждого писателя: два Store() одного исходника (пакетные
+// потоки, объект сцены рядом с фоновой загрузкой) не пишут в один файл
+std::string uniqueTempPath(const std::string& cachePath) {
+    static std::atomic<uint64_t> counter{0};
+    uint64_t token = uint64_t(std::random_device{}()) << 32;
+    token ^= std::hash<std::thread::id>{}(std::this_thread::get_id());
+    token += counter.fetch_add(1, std::memory_order_relaxed);
+    char suffix[32];
+    std::snprintf(suffix, sizeof(suffix), ".%016llx.tmp", static_cast<unsigned long long>(token));
+    return cachePath + suffix;
+}
+
+// Удаляет временный файл на любом пути выхода, пока он не переименован
+class TempFileGuard {
+public:
+    explicit TempFileGuard(std::string path) : path_(std::move(path)) {}
+    ~TempFileGuard() {
+        if (path_.empty()) return;
+        std::error_code ignored;
+        fs::remove(path_, ignored);
+    }
+    void Release() { path_.clear(); }
+
+private:
+    std::string path_;
+};
+
+void writePadding(std::ofstream& out, uint64_t target) {
+    static const char zeros[kSectionAlignment] = {};
+    uint64_t position = static_cast<uint64_t>(out.tellp());
+    if (target > position) out.write(zeros, static_cast<std::streamsize>(target - position));
+}
+
+template <typename T>
+void writeSpan(std::ofstream& out, std::span<const T> data) {
+    out.write(reinterpret_cast<const char*>(data.data()),
+              static_cast<std::streamsize>(data.size_bytes()));
+}
+
+}  // namespace
+
+std::string MeshCache::GetCachePath(const std::string& sourcePath) const {
+    if (directory_.empty()) return sourcePath + ".s21mesh";
+
+    SourceKey key;
+    std::string keyPath = readSourceKey(sourcePath, key) ? key.path : sourcePath;
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.s21mesh",
+                  static_cast<unsigned long long>(hashPath(keyPath)));
+    return (fs::path(directory_) / name).string();
+}
+
+bool MeshCache::Load(const std::string& sourcePath, const NormalizationParameters& params,
+                     Mesh& mesh, VertexOrder order) const {
+    SourceKey key;
+    if (!readSourceKey(sourcePath, key)) return false;
+
+    auto file = std::make_shared<MappedFile>();
+    if (!file->Open(GetCachePath(sourcePath))) return false;
+    if (file->GetSize() < sizeof(MeshCacheHeader)) return false;
+
+    MeshCacheHeader header;
+    std::memcpy(&header, file->GetData(), sizeof(header));
+    bool valid = std::memcmp(header.magic, kMagic, sizeof(kMagic)) == 0 &&
+                 header.version == kVersion && header.byte_order == kByteOrderTag &&
+                 header.file_size == file->GetSize() &&
+                 header.source_size == key.size && header.source_mtime == key.mtime &&
+                 header.target_size == params.GetTargetSize() &&
+                 header.center_model == uint32_t(params.ShouldCenterModel()) &&
+                 header.vertex_order == uint32_t(order) &&
+                 header.path_length == key.path.size() &&
+                 header.path_length <= header.file_size - sizeof(header) &&
+                 header.vertex_count <= std::numeric_limits<uint32_t>::max();
+    if (!valid) return false;
+    if (std::memcmp(file->GetData() + sizeof(header), key.path.data(), key.path.size()) != 0) {
+        return false;
+    }
+
+    // Границы секций (защита от поврежденного файла)
+    const uint64_t fileSize = header.file_size;
+    if (!sectionFits(header.positions_offset, header.vertex_count, 3 * sizeof(float), fileSize) ||
+        !sectionFits(header.edges_offset, header.edge_count, 2 * sizeof(uint32_t), fileSize) ||
+        !sectionFits(header.triangles_offset, header.triangle_count, 3 * sizeof(uint32_t), fileSize) ||
+        !sectionFits(header.normals_offset, header.triangle_count, 3 * sizeof(float), fileSize)) {
+        return false;
+    }
+
+    const char* data = file->GetData();
+    size_t n = static_cast<size_t>(header.vertex_count);
+    const float* positions = reinterpret_cast<const float*>(data + header.positions_offset);
+    const uint32_t* edges = reinterpret_cast<const uint32_t*>(data + header.edges_offset);
+    const uint32_t* triangles = reinterpret_cast<const uint32_t*>(data + header.triangles_offset);
+    const float* normals = reinterpret_cast<const float*>(data + header.normals_offset);
+    size_t t = static_cast<size_t>(header.triangle_count);
+    std::span<const uint32_t> edgeIndices(edges, static_cast<size_t>(header.edge_count * 2));
+    std::span<const uint32_t> triangleIndices(triangles, t * 3);
+    if (!indicesInRange(edgeIndices, header.vertex_count) ||
+        !indicesInRange(triangleIndices, header.vertex_count)) {
+        return false;
+    }
+
+    mesh = Mesh();
+    mesh.AdoptExternal(file, std::span<const float>(positions, n),
+                       std::span<const float>(positions + n, n),
+                       std::span<const float>(positions + 2 * n, n),
+                       edgeIndices, triangleIndices, std::span<const float>(normals, t * 3));
+    return true;
+}
+
+bool MeshCache::Store(const std::string& sourcePath, const NormalizationParameters& params,
+                      const Mesh& mesh, VertexOrder order) const {
+    if (mesh.IsCompact()) return false;  // Кэш хранит float (секции отображаются напрямую)
+    SourceKey key;
+    if (!readSourceKey(sourcePath, key)) return false;
+
+    MeshCacheHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.byte_order = kByteOrderTag;
+    header.path_length = static_cast<uint32_t>(key.path.size());
+    header.source_size = key.size;
+    header.source_mtime = key.mtime;
+    header.target_size = params.GetTargetSize();
+    header.center_model = params.ShouldCenterModel() ? 1 : 0;
+    header.vertex_order = uint32_t(order);
+    header.vertex_count = mesh.GetVertexCount();
+    header.edge_count = mesh.GetEdgeCount();
+    header.triangle_count = mesh.GetTriangleCount();
+
+    header.positions_offset = alignUp(sizeof(header) + header.path_length);
+    header.edges_offset = alignUp(header.positions_offset + header.vertex_count * 3 * sizeof(float));
+    header.triangles_offset = alignUp(header.edges_offset + header.edge_count * 2 * sizeof(uint32_t));
+    header.normals_offset = alignUp(header.triangles_offset + header.triangle_count * 3 * sizeof(uint32_t));
+    header.file_size = header.normals_offset + header.triangle_count * 3 * sizeof(float);
+
+    std::string cachePath = GetCachePath(sourcePath);
+    std::string tempPath = uniqueTempPath(cachePath);
+    std::error_code ec;
+    if (!directory_.empty()) fs::create_directories(directory_, ec);
+    TempFileGuard guard(tempPath);
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out) return false;
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(key.path.data(), static_cast<std::streamsize>(key.path.size()));
+        writePadding(out, header.positions_offset);
+        writeSpan(out, mesh.GetX());
+        writeSpan(out, mesh.GetY());
+        writeSpan(out, mesh.GetZ());
+        writePadding(out, header.edges_offset);
+        writeSpan(out, mesh.GetEdgeIndices());
+        writePadding(out, header.triangles_offset);
+        writeSpan(out, mesh.GetTriangles());
+        writePadding(out, header.normals_offset);
+        writeSpan(out, mesh.GetFaceNormals());
+        out.close();
+        if (!out) return false;
+    }
+    fs::rename(tempPath, cachePath, ec);
+    if (ec) return false;
+    guard.Release();
+    return true;
+}
+
+}  // namespace s21
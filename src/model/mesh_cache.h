@@ -0,0 +1,77 @@
+// MESH_CACHE.H - Бинарный кэш нормализованных моделей
+//
+// ЗАЧЕМ НУЖЕН:
+// Разбор текстового OBJ (даже параллельный) + построение ребер + нормализация
+// занимают секунды на больших моделях. При повторном открытии того же файла
+// с теми же параметрами результат уже известен. Кэш хранит готовый Mesh
+// в бинарном виде, который отображается в память и используется без разбора.
+//
+// ЧТО СОДЕРЖИТ:
+// - MeshCache класс (запись и загрузка кэша) - только чтение/запись файлов кэша
+//
+// ФОРМАТ ФАЙЛА (версия 3, little-endian):
+// - Заголовок MeshCacheHeader: магия "S21M", версия, метка порядка байт,
+//   ключ (размер и mtime исходника, параметры нормализации, порядок вершин),
+//   число вершин, ребер и треугольников, смещения секций
+// - Путь к исходному файлу (защита от коллизий имени кэша)
+// - Секция координат: x[n], y[n], z[n] (float), выравнивание 64 байта
+// - Секция ребер: b0 e0 b1 e1 ... (uint32_t), выравнивание 64 байта
+// - Секция треугольников: a0 b0 c0 ... (uint32_t), выравнивание 64 байта
+// - Секция нормалей граней: nx0 ny0 nz0 ... (float), выравнивание 64 байта
+//
+// КАК РАБОТАЕТ:
+// 1. Имя файла кэша: "<исходник>.s21mesh" рядом с исходником, либо
+//    "<FNV-1a хэш пути>.s21mesh" в каталоге кэша (SetCacheDirectory)
+// 2. Store(): пишет во временный файл и переименовывает (без полузаписанных
+//    кэшей). Имя временного файла у каждого писателя свое: одновременные
+//    записи одного исходника не смешиваются, побеждает последний rename
+// 3. Load(): отображает файл в память (MappedFile), сверяет ключ,
+//    Mesh ссылается на секции напрямую (Mesh::AdoptExternal), без копирования.
+//    Поврежденный файл - промах: смещения и размеры секций сверяются с
+//    размером файла без переполнения, индексы ребер и треугольников - с
+//    числом вершин (один проход по индексам, быстрее разбора OBJ)
+// 4. Любое несовпадение (версия, размер, mtime, параметры, порядок вершин,
+//    путь) -> промах. Файлы прежних версий (1 - без граней, 2 - с неиспользуемыми
+//    границами в заголовке) - промах по версии,
+//    кэш перезаписывается при следующей загрузке
+//
+// Все в namespace s21
+
+#ifndef MESH_CACHE_H_
+#define MESH_CACHE_H_
+
+#include <cstdint>
+#include <string>
+
+#include "mesh_reorder.h"  // VertexOrder
+
+namespace s21 {
+
+class Mesh;
+class NormalizationParameters;
+
+class MeshCache {
+public:
+    static constexpr uint32_t kVersion = 3;
+
+    // Пустая строка -> кэш пишется рядом с исходным файлом
+    void SetCacheDirectory(const std::string& directory) { directory_ = directory; }
+    const std::string& GetCacheDirectory() const { return directory_; }
+
+    // true, если найден действительный кэш; mesh ссылается на отображенный файл
+    bool Load(const std::string& sourcePath, const NormalizationParameters& params, Mesh& mesh,
+              VertexOrder order = VertexOrder::kFile) const;
+
+    // false, если записать не удалось (каталог только для чтения и т.п.)
+    bool Store(const std::string& sourcePath, const NormalizationParameters& params,
+               const Mesh& mesh, VertexOrder order = VertexOrder::kFile) const;
+
+    std::string GetCachePath(const std::string& sourcePath) const;
+
+private:
+    std::string directory_;
+};
+
+}  // namespace s21
+
+#endif  // MESH_CACHE_H_
@@ -0,0 +1,266 @@
+// MESH_CODEC.CPP - Реализация сжатого хранения координат и ребер
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - Квантование координат блоками на ParallelFor (границы - SIMD ядром
+//   ComputePositionBounds), раскодирование кусков и отдельных вершин
+// - Упаковку трех 21-битных значений в uint64
+// - Кодирование ребер varint/zigzag: размеры блоков, смещения, запись
+//   (оба прохода параллельно), раскодирование блока
+
+#include "mesh_codec.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#include "parallel.h"          // ParallelFor
+#include "transform_kernel.h"  // ComputePositionBounds
+
+namespace s21 {
+
+namespace {
+
+constexpr size_t kEncodeBlock = 1u << 16;  // Вершин в одной параллельной задаче
+constexpr uint64_t kMask21 = (1u << 21) - 1;
+
+uint64_t zigzag(int64_t value) { return (uint64_t(value) << 1) ^ uint64_t(value >> 63); }
+int64_t unzigzag(uint64_t value) { return int64_t(value >> 1) ^ -int64_t(value & 1); }
+
+size_t varintSize(uint64_t value) {
+    size_t size = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        ++size;
+    }
+    return size;
+}
+
+uint8_t* writeVarint(uint8_t* out, uint64_t value) {
+    while (value >= 0x80) {
+        *out++ = uint8_t(value) | 0x80;
+        value >>= 7;
+    }
+    *out++ = uint8_t(value);
+    return out;
+}
+
+const uint8_t* readVarint(const uint8_t* in, uint64_t& value) {
+    value = 0;
+    for (int shift = 0;; shift += 7) {
+        uint8_t byte = *in++;
+        value |= uint64_t(byte & 0x7f) << shift;
+        if (byte < 0x80) return in;
+    }
+}
+
+// Блок ребер: разности begin внутри блока и end - begin
+template <typename Fn>
+void forEdgeCodes(std::span<const uint32_t> edges, size_t block, Fn&& fn) {
+    size_t first = block * EdgeStream::kBlockEdges;
+    size_t last = std::min(edges.size() / 2, first + EdgeStream::kBlockEdges);
+    int64_t previous = 0;
+    for (size_t e = first; e < last; ++e) {
+        int64_t begin = edges[e * 2], end = edges[e * 2 + 1];
+        fn(zigzag(begin - previous), zigzag(end - begin));
+        previous = begin;
+    }
+}
+
+}  // namespace
+
+const char* GetVertexPrecisionName(VertexPrecision precision) {
+    switch (precision) {
+        case VertexPrecision::kBits16: return "16-bit";
+        case VertexPrecision::kBits21: return "21-bit";
+        case VertexPrecision::kFloat: break;
+    }
+    return "float";
+}
+
+// ====== QuantizedPositions ======
+
+QuantizedPositions QuantizedPositions::Encode(std::span<const float> x, std::span<const float> y,
+                                              std::span<const float> z, VertexPrecision precision) {
+    QuantizedPositions result;
+    result.precision_ = precision == VertexPrecision::kBits21 ? precision : VertexPrecision::kBits16;
+    const bool wide = result.precision_ == VertexPrecision::kBits21;
+    const size_t count = x.size();
+    result.count_ = count;
+    if (count == 0) return result;
+
+    float min[3], max[3];
+    ComputePositionBounds(x.data(), y.data(), z.data(), count, min, max);
+    const float top = wide ? float(kMask21) : 65535.0f;
+    float inverse[3];
+    for (int axis = 0; axis < 3; ++axis) {
+        float extent = max[axis] - min[axis];
+        result.origin_[axis] = min[axis];
+        result.step_[axis] = extent > 0.0f ? extent / top : 0.0f;
+        inverse[axis] = extent > 0.0f ? top / extent : 0.0f;
+    }
+    auto quantize = [&](float value, int axis) {
+        float code = std::nearbyint((value - min[axis]) * inverse[axis]);
+        return uint32_t(std::clamp(code, 0.0f, top));
+    };
+
+    if (wide) {
+        result.packed_.resize(count);
+    } else {
+        result.x_.resize(count);
+        result.y_.resize(count);
+        result.z_.resize(count);
+    }
+    const size_t blocks = (count + kEncodeBlock - 1) / kEncodeBlock;
+    std::vector<uint32_t> blockMax(blocks * 3, 0);
+    ParallelFor(blocks, [&](size_t block) {
+        uint32_t* top3 = blockMax.data() + block * 3;
+        size_t end = std::min(count, (block + 1) * kEncodeBlock);
+        for (size_t i = block * kEncodeBlock; i < end; ++i) {
+            uint32_t qx = quantize(x[i], 0), qy = quantize(y[i], 1), qz = quantize(z[i], 2);
+            top3[0] = std::max(top3[0], qx);
+            top3[1] = std::max(top3[1], qy);
+            top3[2] = std::max(top3[2], qz);
+            if (wide) {
+                result.packed_[i] = uint64_t(qx) | uint64_t(qy) << 21 | uint64_t(qz) << 42;
+            } else {
+                result.x_[i] = uint16_t(qx);
+                result.y_[i] = uint16_t(qy);
+                result.z_[i] = uint16_t(qz);
+            }
+        }
+    });
+    for (size_t block = 0; block < blocks; ++block) {
+        for (int axis = 0; axis < 3; ++axis) {
+            result.max_code_[axis] = std::max(result.max_code_[axis], blockMax[block * 3 + axis]);
+        }
+    }
+    return result;
+}
+
+// Шаг и начало - в локальных переменных: запись в x, y, z не может их
+// изменить, и цикл векторизуется
+void QuantizedPositions::Decode(size_t first, size_t count, float* x, float* y, float* z) const {
+    const float ox = origin_[0], oy = origin_[1], oz = origin_[2];
+    const float sx = step_[0], sy = step_[1], sz = step_[2];
+    if (precision_ == VertexPrecision::kBits21) {
+        const uint64_t* packed = packed_.data() + first;
+        for (size_t i = 0; i < count; ++i) {
+            x[i] = ox + float(uint32_t(packed[i] & kMask21)) * sx;
+            y[i] = oy + float(uint32_t(packed[i] >> 21 & kMask21)) * sy;
+            z[i] = oz + float(uint32_t(packed[i] >> 42)) * sz;
+        }
+        return;
+    }
+    const uint16_t *qx = x_.data() + first, *qy = y_.data() + first, *qz = z_.data() + first;
+    for (size_t i = 0; i < count; ++i) x[i] = ox + float(qx[i]) * sx;
+    for (size_t i = 0; i < count; ++i) y[i] = oy + float(qy[i]) * sy;
+    for (size_t i = 0; i < count; ++i) z[i] = oz + float(qz[i]) * sz;
+}
+
+void QuantizedPositions::Gather(size_t first, size_t count, size_t stride, float* x, float* y,
+                                float* z) const {
+    for (size_t i = 0; i < count; ++i) {
+        float position[3];
+        DecodeOne(first + i * stride, position);
+        x[i] = position[0], y[i] = position[1], z[i] = position[2];
+    }
+}
+
+void QuantizedPositions::DecodeOne(size_t index, float out[3]) const {
+    if (precision_ == VertexPrecision::kBits21) {
+        uint64_t packed = packed_[index];
+        out[0] = decode(uint32_t(packed & kMask21), 0);
+        out[1] = decode(uint32_t(packed >> 21 & kMask21), 1);
+        out[2] = decode(uint32_t(packed >> 42), 2);
+        return;
+    }
+    out[0] = decode(x_[index], 0);
+    out[1] = decode(y_[index], 1);
+    out[2] = decode(z_[index], 2);
+}
+
+// Наименьшее значение по оси - 0 (начало отсчета - минимум координат)
+void QuantizedPositions::GetBounds(float min[3], float max[3]) const {
+    for (int axis = 0; axis < 3; ++axis) {
+        min[axis] = decode(0, axis);
+        max[axis] = decode(max_code_[axis], axis);
+    }
+}
+
+// Половина шага плюс округление float в origin + q * step (по ulp границ)
+float QuantizedPositions::GetMaxError() const {
+    float error = 0.0f;
+    for (int axis = 0; axis < 3; ++axis) {
+        float magnitude = std::max(std::abs(origin_[axis]), std::abs(decode(max_code_[axis], axis)));
+        error = std::max(error, 0.5f * step_[axis] + 2.0f * FLT_EPSILON * magnitude);
+    }
+    return error;
+}
+
+size_t QuantizedPositions::GetMemoryBytes() const {
+    return (x_.capacity() + y_.capacity() + z_.capacity()) * sizeof(uint16_t) +
+           packed_.capacity() * sizeof(uint64_t);
+}
+
+// ====== EdgeStream ======
+
+EdgeStream EdgeStream::Encode(std::span<const uint32_t> edges) {
+    EdgeStream result;
+    result.edge_count_ = edges.size() / 2;
+    const size_t blocks = (result.edge_count_ + kBlockEdges - 1) / kBlockEdges;
+    result.offsets_.assign(blocks + 1, 0);
+
+    // 1. Размер каждого блока, затем смещения
+    ParallelFor(blocks, [&](size_t block) {
+        size_t size = 0;
+        forEdgeCodes(edges, block, [&](uint64_t begin, uint64_t end) {
+            size += varintSize(begin) + varintSize(end);
+        });
+        result.offsets_[block + 1] = size;
+    });
+    for (size_t block = 0; block < blocks; ++block) result.offsets_[block + 1] += result.offsets_[block];
+
+    // 2. Запись блоков на свои места
+    result.bytes_.resize(result.offsets_[blocks]);
+    ParallelFor(blocks, [&](size_t block) {
+        uint8_t* out = result.bytes_.data() + result.offsets_[block];
+        forEdgeCodes(edges, block, [&](uint64_t begin, uint64_t end) {
+            out = writeVarint(writeVarint(out, begin), end);
+        });
+    });
+    return result;
+}
+
+size_t EdgeStream::DecodeBlock(size_t block, uint32_t* out) const {
+    const uint8_t* in = bytes_.data() + offsets_[block];
+    size_t count = std::min(kBlockEdges, edge_count_ - block * kBlockEdges);
+    int64_t previous = 0;
+    for (size_t e = 0; e < count; ++e) {
+        uint64_t begin, end;
+        in = readVarint(readVarint(in, begin), end);
+        previous += unzigzag(begin);
+        out[e * 2] = uint32_t(previous);
+        out[e * 2 + 1] = uint32_t(previous + unzigzag(end));
+    }
+    return count;
+}
+
+void EdgeStream::DecodeAll(std::vector<uint32_t>& out) const {
+    out.resize(edge_count_ * 2);
+    ParallelFor(GetBlockCount(), [&](size_t block) {
+        DecodeBlock(block, out.data() + block * kBlockEdges * 2);
+    });
+}
+
+void EdgeStream::GetEdge(size_t index, uint32_t& begin, uint32_t& end) const {
+    uint32_t pairs[kBlockEdges * 2];
+    DecodeBlock(index / kBlockEdges, pairs);
+    begin = pairs[index % kBlockEdges * 2];
+    end = pairs[index % kBlockEdges * 2 + 1];
+}
+
+size_t EdgeStream::GetMemoryBytes() const {
+    return bytes_.capacity() + offsets_.capacity() * sizeof(uint64_t);
+}
+
+}  // namespace s21
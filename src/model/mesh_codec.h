@@ -0,0 +1,132 @@
+// MESH_CODEC.H - Сжатое хранение координат и ребер Mesh (по выбору)
+//
+// ЗАЧЕМ НУЖЕН:
+// Mesh хранит 12 байт на вершину (float x, y, z) и 8 байт на ребро (два
+// uint32). После нормализации модель лежит в известных границах, и
+// точность float для отрисовки избыточна: квантованные координаты и
+// разностное кодирование ребер уменьшают память координат и ребер примерно
+// вдвое (сфера 1M вершин: 28 -> 13 байт на вершину), и в ту же память
+// помещается модель вдвое больше. Грани (SolidStrategy) не сжимаются.
+//
+// ЧТО СОДЕРЖИТ:
+// - VertexPrecision - способ хранения координат (float / 16 / 21 бит на ось)
+// - QuantizedPositions - квантованные координаты и их раскодирование кусками
+// - EdgeStream - ребра, закодированные разностями блоками по kBlockEdges
+// - CompactGeometry - координаты и ребра сжатого Mesh
+// - PositionChunk, PositionPointers - кусок координат для ядер проекции
+//
+// КАК РАБОТАЕТ:
+// 1. Координаты: по каждой оси шаг = (max - min) / (2^bits - 1), значение
+//    хранится как round((v - min) / шаг). 16 бит - три массива uint16
+//    (6 байт на вершину), 21 бит - x | y << 21 | z << 42 в одном uint64
+//    (8 байт)
+// 2. Раскодирование: v = min + q * шаг во float, одинаково во всех потоках.
+//    Decode() раскодирует кусок подряд, Gather() - каждую stride-ю вершину;
+//    ядра проекции получают кусок во временных массивах на стеке
+// 3. Точность (GetMaxError): ошибка не больше половины шага по оси. Для
+//    нормализованной модели (NormalizationParameters: размер 1 по
+//    наибольшей оси): 16 бит - 7.6e-6 (0.0008% размера, 0.015 пикселя при
+//    модели в 2000 пикселей), 21 бит - 2.4e-7 (у самого float на краю
+//    модели - 3e-8). Ошибка не накапливается: координаты раскодируются
+//    заново для каждого кадра, матрица модели к ним не применяется
+// 4. Ребра: блоки по kBlockEdges ребер, блок начинается с нулевой базы
+//    (раскодируется независимо - параллельно и с любого блока). Ребро -
+//    два varint (7 бит в байте): zigzag(begin - begin предыдущего) и
+//    zigzag(end - begin). После перестановки Мортона (mesh_reorder.h)
+//    ребра отсортированы и соседние по индексам - 2-4 байта на ребро
+// 5. Кодирование параллельно: размеры блоков -> смещения -> запись блоков
+//
+// Все в namespace s21
+
+#ifndef MESH_CODEC_H_
+#define MESH_CODEC_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace s21 {
+
+enum class VertexPrecision : uint32_t {
+    kFloat = 0,    // float x, y, z - 12 байт на вершину (по умолчанию)
+    kBits16 = 16,  // uint16 на ось - 6 байт
+    kBits21 = 21   // 21 бит на ось в uint64 - 8 байт
+};
+
+const char* GetVertexPrecisionName(VertexPrecision precision);
+
+// Кусок координат на стеке: сюда раскодируются квантованные вершины
+struct PositionChunk {
+    static constexpr size_t kSize = 512;
+    float x[kSize], y[kSize], z[kSize];
+};
+
+// Координаты куска: в массивы Mesh (float) или в PositionChunk
+struct PositionPointers {
+    const float* x;
+    const float* y;
+    const float* z;
+};
+
+class QuantizedPositions {
+public:
+    // precision - kBits16 или kBits21; границы - min/max самих координат
+    static QuantizedPositions Encode(std::span<const float> x, std::span<const float> y,
+                                     std::span<const float> z, VertexPrecision precision);
+
+    size_t GetCount() const { return count_; }
+    VertexPrecision GetPrecision() const { return precision_; }
+
+    // Вершины [first, first + count) -> x, y, z
+    void Decode(size_t first, size_t count, float* x, float* y, float* z) const;
+    // Вершины first, first + stride, ... (count штук) -> x, y, z
+    void Gather(size_t first, size_t count, size_t stride, float* x, float* y, float* z) const;
+    void DecodeOne(size_t index, float out[3]) const;
+
+    // Границы раскодированных координат (точные, без прохода по вершинам)
+    void GetBounds(float min[3], float max[3]) const;
+    float GetMaxError() const;    // Наибольшая ошибка координаты (половина шага + округление)
+    size_t GetMemoryBytes() const;
+
+private:
+    VertexPrecision precision_ = VertexPrecision::kBits16;
+    size_t count_ = 0;
+    float origin_[3] = {0.0f, 0.0f, 0.0f};
+    float step_[3] = {0.0f, 0.0f, 0.0f};
+    uint32_t max_code_[3] = {0, 0, 0};  // Наибольшее значение по оси среди вершин
+    std::vector<uint16_t> x_, y_, z_;   // kBits16
+    std::vector<uint64_t> packed_;      // kBits21
+
+    float decode(uint32_t code, int axis) const { return origin_[axis] + float(code) * step_[axis]; }
+};
+
+class EdgeStream {
+public:
+    static constexpr size_t kBlockEdges = 256;
+
+    // edges - b0 e0 b1 e1 ...
+    static EdgeStream Encode(std::span<const uint32_t> edges);
+
+    size_t GetEdgeCount() const { return edge_count_; }
+    size_t GetBlockCount() const { return offsets_.empty() ? 0 : offsets_.size() - 1; }
+    // Ребра блока -> out (не больше 2 * kBlockEdges индексов); возвращает число ребер
+    size_t DecodeBlock(size_t block, uint32_t* out) const;
+    void DecodeAll(std::vector<uint32_t>& out) const;  // Все ребра, параллельно
+    void GetEdge(size_t index, uint32_t& begin, uint32_t& end) const;  // Через свой блок
+    size_t GetMemoryBytes() const;
+
+private:
+    size_t edge_count_ = 0;
+    std::vector<uint8_t> bytes_;
+    std::vector<uint64_t> offsets_;  // Начало каждого блока в bytes_ (блоков + 1)
+};
+
+struct CompactGeometry {
+    QuantizedPositions positions;
+    EdgeStream edges;
+};
+
+}  // namespace s21
+
+#endif  // MESH_CODEC_H_
@@ -0,0 +1,70 @@
+// MESH_LOADER.CPP - Реализация фоновой загрузки модели
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - Запуск рабочего потока и прогрессивное чтение через FileReader
+// - Передачу прогресса и черновых Mesh в обработчики
+// - Построение MeshLodChain и EdgeGrid для готового Mesh в том же потоке
+// - Отмену (флаг) и ожидание потока в деструкторе
+
+#include "mesh_loader.h"
+
+#include <utility>
+
+#include "profiler.h"
+
+namespace s21 {
+
+MeshLoadTask::MeshLoadTask(std::string path, NormalizationParameters params, FileReader& reader,
+                           MeshLoadHandlers handlers)
+    : path_(std::move(path)), params_(params), handlers_(std::move(handlers)), reader_(reader) {}
+
+MeshLoadTask::~MeshLoadTask() {
+    Cancel();
+    if (thread_.joinable()) thread_.join();
+}
+
+void MeshLoadTask::Start() {
+    thread_ = std::thread(&MeshLoadTask::run, this);
+}
+
+void MeshLoadTask::run() {
+    FacadeOperationResult result = reader_.ReadMesh(path_, params_, *this);
+    MeshAccelerators accelerators;
+    if (result.IsSuccess() && !BuildMeshAccelerators(result.GetMesh(), accelerators, &cancelled_)) {
+        result = FacadeOperationResult(false, kLoadCancelledMessage);
+    }
+    finished_.store(true, std::memory_order_release);
+    if (handlers_.on_finished) handlers_.on_finished(std::move(result), std::move(accelerators));
+}
+
+bool BuildMeshAccelerators(const Mesh& mesh, MeshAccelerators& out,
+                           const std::atomic<bool>* cancelled) {
+    auto isCancelled = [&] { return cancelled && cancelled->load(std::memory_order_relaxed); };
+    if (isCancelled()) return false;
+    auto lods = std::make_shared<MeshLodChain>();
+    {
+        S21_PROFILE_SCOPE("load: lods", kLoad);
+        if (!lods->Build(mesh, cancelled)) return false;
+    }
+    if (isCancelled()) return false;
+    auto grid = std::make_shared<EdgeGrid>();
+    {
+        S21_PROFILE_SCOPE("load: edge grid", kLoad);
+        if (!grid->Build(mesh, cancelled)) return false;
+    }
+    out.lods = std::move(lods);
+    out.edge_grid = std::move(grid);
+    return true;
+}
+
+void MeshLoadTask::OnProgress(const LoadProgress& progress) {
+    if (handlers_.on_progress) handlers_.on_progress(progress);
+}
+
+void MeshLoadTask::OnPartialMesh(Mesh preview, const LoadProgress& progress) {
+    if (handlers_.on_partial) {
+        handlers_.on_partial(std::make_shared<const Mesh>(std::move(preview)), progress);
+    }
+}
+
+}  // namespace s21
@@ -0,0 +1,95 @@
+// MESH_LOADER.H - Фоновая загрузка модели с черновыми результатами
+//
+// ЗАЧЕМ НУЖЕН:
+// Model::LoadMesh() разбирает файл синхронно, и цикл событий Qt замирает
+// на все время загрузки большого файла. MeshLoadTask выполняет загрузку
+// в рабочем потоке, публикует прогресс и растущий черновой Mesh, и может
+// быть отменена без разрушения Model (текущая модель остается на экране).
+//
+// ЧТО СОДЕРЖИТ:
+// - MeshLoadTask класс (один поток на одну загрузку, FileReader - снаружи)
+// - MeshLoadHandlers - обработчики прогресса, чернового Mesh и результата
+// - BuildMeshAccelerators() - LOD и индекс ребер для загруженного Mesh
+//
+// КАК РАБОТАЕТ:
+// 1. Start() запускает поток: FileReader::ReadMesh(path, params, observer).
+//    FileReader передается снаружи и живет дольше задачи (Model держит
+//    один на все фоновые загрузки): буферы разбора, таблица ребер и куски
+//    ObjParser сохраняют емкость между загрузками
+// 2. FileReader читает файл кусками и вызывает OnProgress/OnPartialMesh
+// 3. Обработчики вызываются В РАБОЧЕМ ПОТОКЕ - вызывающая сторона
+//    (Controller) сама переносит их в GUI поток
+// 4. Cancel() выставляет флаг, FileReader проверяет его между кусками,
+//    между фазами после разбора (ребра, перестановка, нормализация, кэш)
+//    и завершается с kLoadCancelledMessage - деструктор, вызванный из GUI
+//    потока новой загрузкой, ждет не дольше одной фазы
+// 5. После успешного чтения в том же потоке строятся MeshAccelerators:
+//    MeshLodChain и EdgeGrid (отменяются тем же флагом)
+// 6. on_finished вызывается ровно один раз, последним
+// 7. Деструктор отменяет загрузку и дожидается потока
+//
+// Все в namespace s21
+
+#ifndef MESH_LOADER_H_
+#define MESH_LOADER_H_
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "io.h"        // FileReader, LoadObserver, LoadProgress, NormalizationParameters
+#include "edge_grid.h" // EdgeGrid
+#include "mesh_lod.h"  // MeshLodChain
+#include "model.h"     // Mesh, FacadeOperationResult, MeshAccelerators
+
+namespace s21 {
+
+struct MeshLoadHandlers {
+    std::function<void(const LoadProgress&)> on_progress;
+    std::function<void(std::shared_ptr<const Mesh>, const LoadProgress&)> on_partial;
+    // accelerators - LOD и индекс ребер загруженного mesh'а (пусто для ошибки)
+    std::function<void(FacadeOperationResult, MeshAccelerators)> on_finished;
+};
+
+// false - построение отменено через cancelled (out не меняется)
+bool BuildMeshAccelerators(const Mesh& mesh, MeshAccelerators& out,
+                           const std::atomic<bool>* cancelled = nullptr);
+
+class MeshLoadTask : private LoadObserver {
+public:
+    // reader до конца задачи (деструктора) не используется другими потоками
+    MeshLoadTask(std::string path, NormalizationParameters params, FileReader& reader,
+                 MeshLoadHandlers handlers);
+    ~MeshLoadTask();
+
+    MeshLoadTask(const MeshLoadTask&) = delete;
+    MeshLoadTask& operator=(const MeshLoadTask&) = delete;
+
+    void SetVertexPrecision(VertexPrecision precision) { reader_.SetVertexPrecision(precision); }  // До Start()
+    void Start();
+    void Cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+    bool IsFinished() const { return finished_.load(std::memory_order_acquire); }
+    const std::string& GetPath() const { return path_; }
+
+private:
+    std::string path_;
+    NormalizationParameters params_;
+    MeshLoadHandlers handlers_;
+    FileReader& reader_;  // Не FileReader GUI потока (Model::LoadMesh идет параллельно)
+    std::atomic<bool> cancelled_{false};
+    std::atomic<bool> finished_{false};
+    std::thread thread_;
+
+    void run();
+
+    // LoadObserver
+    bool IsCancelled() const override { return cancelled_.load(std::memory_order_relaxed); }
+    void OnProgress(const LoadProgress& progress) override;
+    void OnPartialMesh(Mesh preview, const LoadProgress& progress) override;
+};
+
+}  // namespace s21
+
+#endif  // MESH_LOADER_H_
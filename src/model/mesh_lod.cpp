@@ -0,0 +1,247 @@
+// MESH_LOD.CPP - Реализация упрощения mesh'а кластеризацией вершин
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - Номер ячейки для каждой вершины (параллельно по блокам)
+// - ClusterTable: ячейка -> номер кластера, открытая адресация по uint64
+//   (ячейка << 32 | кластер), как в EdgeBuilder; таблица растет по мере
+//   появления новых ячеек
+// - Суммы координат кластеров в double, затем среднее во float
+// - Ребра кластеров: ключи (min << 32 | max) раскладываются по kEdgeBuckets
+//   корзинам по старшим битам хэша, повторы убираются в каждой корзине
+//   отдельно (параллельно, небольшая таблица на корзину помещается в кэш);
+//   порядок - по корзинам, внутри корзины - первое появление (не зависит
+//   от числа потоков)
+// - MeshLodChain::Build(): уровни с уменьшением разрешения вдвое
+
+#include "mesh_lod.h"
+
+#include <algorithm>
+#include <bit>
+
+#include "parallel.h"
+
+namespace s21 {
+
+namespace {
+
+constexpr size_t kCellBlock = 1u << 16;  // Вершин (ребер) в одной параллельной задаче
+constexpr size_t kEdgeBuckets = 64;
+constexpr int kBucketShift = 58;          // 64 - log2(kEdgeBuckets)
+
+uint64_t hashKey(uint64_t key) { return key * 0x9E3779B97F4A7C15ull; }
+
+// Множество ключей ребер (min < max, поэтому ~0 недостижим). expected -
+// верхняя граница числа вставок, поэтому рост таблицы не нужен
+class EdgeSet {
+public:
+    explicit EdgeSet(size_t expected)
+        : table_(std::bit_ceil(std::max<size_t>(16, expected * 2)), kEmpty), mask_(table_.size() - 1) {}
+
+    bool Insert(uint64_t key) {  // true - ключ новый
+        size_t slot = static_cast<size_t>(hashKey(key) >> 20) & mask_;
+        while (table_[slot] != kEmpty) {
+            if (table_[slot] == key) return false;
+            slot = (slot + 1) & mask_;
+        }
+        table_[slot] = key;
+        return true;
+    }
+
+private:
+    static constexpr uint64_t kEmpty = ~uint64_t(0);
+
+    std::vector<uint64_t> table_;  // Не меньше 2 * expected: заполнена не больше чем наполовину
+    size_t mask_;
+};
+
+class ClusterTable {
+public:
+    explicit ClusterTable(size_t expected) { rehash(std::bit_ceil(std::max<size_t>(16, expected * 2))); }
+
+    // Номер кластера ячейки; новая ячейка получает номер count
+    uint32_t FindOrAdd(uint32_t cell, uint32_t count) {
+        size_t slot = slotOf(cell);
+        while (table_[slot] != kEmpty) {
+            if (uint32_t(table_[slot] >> 32) == cell) return uint32_t(table_[slot]);
+            slot = (slot + 1) & mask_;
+        }
+        table_[slot] = (uint64_t(cell) << 32) | count;
+        if (++used_ * 4 > table_.size() * 3) rehash(table_.size() * 2);
+        return count;
+    }
+
+private:
+    static constexpr uint64_t kEmpty = ~uint64_t(0);  // Ячейка 2^32-1 недостижима (resolution <= 1024)
+
+    std::vector<uint64_t> table_;
+    size_t mask_ = 0;
+    size_t used_ = 0;
+
+    size_t slotOf(uint32_t cell) const {
+        return static_cast<size_t>((uint64_t(cell) * 0x9E3779B97F4A7C15ull) >> 32) & mask_;
+    }
+
+    void rehash(size_t capacity) {
+        std::vector<uint64_t> old = std::move(table_);
+        table_.assign(capacity, kEmpty);
+        mask_ = capacity - 1;
+        for (uint64_t entry : old) {
+            if (entry == kEmpty) continue;
+            size_t slot = slotOf(uint32_t(entry >> 32));
+            while (table_[slot] != kEmpty) slot = (slot + 1) & mask_;
+            table_[slot] = entry;
+        }
+    }
+};
+
+}  // namespace
+
+Mesh SimplifyByClustering(const Mesh& mesh, const BoundingBox& bounds, uint32_t resolution) {
+    std::span<const float> x = mesh.GetX(), y = mesh.GetY(), z = mesh.GetZ();
+    const size_t count = x.size();
+    resolution = std::clamp<uint32_t>(resolution, 1, 1024);
+
+    // 1. Ячейка каждой вершины
+    const double origin[3] = {bounds.min.x, bounds.min.y, bounds.min.z};
+    const double extent[3] = {bounds.max.x - bounds.min.x, bounds.max.y - bounds.min.y,
+                              bounds.max.z - bounds.min.z};
+    float scale[3];
+    for (int axis = 0; axis < 3; ++axis) {
+        scale[axis] = extent[axis] > 0.0 ? float(resolution / extent[axis]) : 0.0f;
+    }
+    auto cellIndex = [&](float value, int axis) {
+        float cell = (value - float(origin[axis])) * scale[axis];
+        return std::min(uint32_t(std::max(cell, 0.0f)), resolution - 1);
+    };
+
+    std::vector<uint32_t> cells(count);
+    ParallelFor((count + kCellBlock - 1) / kCellBlock, [&](size_t block) {
+        size_t end = std::min(count, (block + 1) * kCellBlock);
+        for (size_t i = block * kCellBlock; i < end; ++i) {
+            cells[i] = (cellIndex(z[i], 2) * resolution + cellIndex(y[i], 1)) * resolution +
+                       cellIndex(x[i], 0);
+        }
+    });
+
+    // 2. Кластеры в порядке первого появления (детерминированно) и их центры
+    ClusterTable table(std::min<size_t>(count, size_t(resolution) * resolution * 4));
+    std::vector<uint32_t>& clusterOf = cells;  // Ячейка больше не нужна - номер кластера на ее место
+    std::vector<double> sums;
+    std::vector<uint32_t> members;
+    uint32_t clusters = 0;
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t cluster = table.FindOrAdd(cells[i], clusters);
+        if (cluster == clusters) {
+            ++clusters;
+            sums.resize(sums.size() + 3, 0.0);
+            members.push_back(0);
+        }
+        sums[cluster * 3] += x[i];
+        sums[cluster * 3 + 1] += y[i];
+        sums[cluster * 3 + 2] += z[i];
+        ++members[cluster];
+        clusterOf[i] = cluster;
+    }
+
+    std::vector<float> outX(clusters), outY(clusters), outZ(clusters);
+    for (uint32_t c = 0; c < clusters; ++c) {
+        double inverse = 1.0 / members[c];
+        outX[c] = float(sums[c * 3] * inverse);
+        outY[c] = float(sums[c * 3 + 1] * inverse);
+        outZ[c] = float(sums[c * 3 + 2] * inverse);
+    }
+
+    // 3. Ребра между кластерами: ключи по корзинам (блоки по порядку ребер)
+    std::span<const uint32_t> edges = mesh.GetEdgeIndices();
+    const size_t edgeCount = edges.size() / 2;
+    const size_t blocks = (edgeCount + kCellBlock - 1) / kCellBlock;
+    std::vector<std::vector<uint64_t>> bucketed(blocks * kEdgeBuckets);
+    ParallelFor(blocks, [&](size_t block) {
+        std::vector<uint64_t>* buckets = bucketed.data() + block * kEdgeBuckets;
+        size_t end = std::min(edgeCount, (block + 1) * kCellBlock);
+        for (size_t e = block * kCellBlock; e < end; ++e) {
+            uint32_t a = clusterOf[edges[e * 2]], b = clusterOf[edges[e * 2 + 1]];
+            if (a == b) continue;  // Ребро внутри кластера
+            uint64_t key = a < b ? (uint64_t(a) << 32) | b : (uint64_t(b) << 32) | a;
+            buckets[hashKey(key) >> kBucketShift].push_back(key);
+        }
+    });
+
+    // 4. Повторы убираются в каждой корзине независимо
+    std::vector<std::vector<uint32_t>> unique(kEdgeBuckets);
+    ParallelFor(kEdgeBuckets, [&](size_t bucket) {
+        size_t keys = 0;
+        for (size_t block = 0; block < blocks; ++block) keys += bucketed[block * kEdgeBuckets + bucket].size();
+        EdgeSet set(keys);  // Все ключи корзины могут оказаться разными (облако, мелкие кластеры)
+        std::vector<uint32_t>& out = unique[bucket];
+        for (size_t block = 0; block < blocks; ++block) {
+            for (uint64_t key : bucketed[block * kEdgeBuckets + bucket]) {
+                if (!set.Insert(key)) continue;
+                out.push_back(uint32_t(key >> 32));
+                out.push_back(uint32_t(key));
+            }
+        }
+    });
+
+    size_t total = 0;
+    for (const auto& bucket : unique) total += bucket.size();
+    std::vector<uint32_t> resultEdges;
+    resultEdges.reserve(total);
+    for (const auto& bucket : unique) resultEdges.insert(resultEdges.end(), bucket.begin(), bucket.end());
+
+    Mesh result;
+    result.SetPositions(std::move(outX), std::move(outY), std::move(outZ));
+    result.SetEdges(std::move(resultEdges));
+    return result;
+}
+
+// ====== MeshLodChain ======
+
+bool MeshLodChain::Build(const Mesh& mesh, const std::atomic<bool>* cancelled) {
+    levels_.clear();
+    if (mesh.GetEdgeCount() < kMinSourceEdges) return true;
+    if (mesh.IsCompact()) {
+        // Кластеризация читает массивы float: уровни строятся из раскодированной
+        // копии и сжимаются с той же точностью
+        Mesh expanded = mesh;
+        expanded.SetVertexPrecision(VertexPrecision::kFloat);
+        if (!Build(expanded, cancelled)) return false;
+        for (Mesh& level : levels_) level.SetVertexPrecision(mesh.GetVertexPrecision());
+        return true;
+    }
+
+    // Общие границы: ячейки соседних уровней вложены друг в друга
+    BoundingBox bounds = mesh.ComputeBounds();
+    levels_.reserve(std::bit_width(kFinestResolution));  // source указывает на levels_.back()
+    const Mesh* source = &mesh;
+    size_t keptEdges = mesh.GetEdgeCount();
+    Mesh candidate;
+    for (uint32_t resolution = kFinestResolution; resolution >= 2; resolution /= 2) {
+        if (cancelled && cancelled->load(std::memory_order_relaxed)) {
+            levels_.clear();
+            return false;
+        }
+        candidate = SimplifyByClustering(*source, bounds, resolution);
+        size_t edges = candidate.GetEdgeCount();
+        if (edges * 2 <= keptEdges) {
+            keptEdges = edges;
+            levels_.push_back(std::move(candidate));
+            source = &levels_.back();
+            if (edges <= kCoarsestEdges) break;
+        } else {
+            // Уровень почти не упростил модель: следующий строится из него же
+            source = &candidate;
+        }
+    }
+    return true;
+}
+
+const Mesh* MeshLodChain::Select(size_t edgeBudget) const {
+    if (levels_.empty()) return nullptr;
+    for (const Mesh& level : levels_) {
+        if (level.GetEdgeCount() <= edgeBudget) return &level;
+    }
+    return &levels_.back();
+}
+
+}  // namespace s21
@@ -0,0 +1,69 @@
+// MESH_LOD.H - Упрощенная геометрия для больших моделей (уровни детализации)
+//
+// ЗАЧЕМ НУЖЕН:
+// Скан на 20M ребер не перерисовывается 60 раз в секунду. Пока пользователь
+// вращает или масштабирует модель, достаточно грубой версии с теми же
+// очертаниями; полная модель рисуется, когда ввод прекратился.
+//
+// ЧТО СОДЕРЖИТ:
+// - SimplifyByClustering() - упрощение кластеризацией вершин по сетке
+// - MeshLodChain класс - цепочка уровней от детального к грубому
+//
+// КАК РАБОТАЕТ:
+// 1. Ограничивающий параллелепипед делится на resolution^3 ячеек
+// 2. Все вершины одной ячейки сливаются в одну (среднее положение);
+//    кластеры нумеруются в порядке первого появления вершин
+// 3. Ребра переводятся на кластеры, ребра внутри кластера отбрасываются,
+//    повторы убираются (хэш-множество ключей min << 32 | max, как в EdgeBuilder)
+// 4. MeshLodChain::Build(): разрешение kFinestResolution, затем вдвое меньше
+//    и т.д.; каждый уровень строится из предыдущего (дешевле с каждым шагом).
+//    Уровень сохраняется, если в нем не больше половины ребер предыдущего
+//    сохраненного; построение заканчивается на kCoarsestEdges ребрах
+// 5. Координаты уровней - в той же локальной системе, что у исходного mesh'а:
+//    к ним применяется та же матрица модели
+// 6. Select(budget) - самый детальный уровень, укладывающийся в бюджет ребер
+// 7. Сжатый mesh (mesh_codec.h): уровни строятся из раскодированной копии
+//    и сжимаются с той же точностью
+//
+// Все в namespace s21
+
+#ifndef MESH_LOD_H_
+#define MESH_LOD_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "model.h"  // Mesh, BoundingBox
+
+namespace s21 {
+
+// Кластеризация вершин по сетке resolution^3 в границах bounds
+Mesh SimplifyByClustering(const Mesh& mesh, const BoundingBox& bounds, uint32_t resolution);
+
+class MeshLodChain {
+public:
+    static constexpr size_t kMinSourceEdges = 1u << 20;  // Меньшие модели рисуются целиком
+    static constexpr size_t kCoarsestEdges = 1u << 14;
+    static constexpr uint32_t kFinestResolution = 1024;
+
+    // true - цепочка построена (возможно, пустая для маленькой модели);
+    // false - построение отменено через cancelled
+    bool Build(const Mesh& mesh, const std::atomic<bool>* cancelled = nullptr);
+
+    bool IsEmpty() const { return levels_.empty(); }
+    size_t GetLevelCount() const { return levels_.size(); }
+    const Mesh& GetLevel(size_t index) const { return levels_[index]; }  // 0 - самый детальный
+
+    // Самый детальный уровень с числом ребер <= edgeBudget, иначе самый грубый;
+    // nullptr - уровней нет
+    const Mesh* Select(size_t edgeBudget) const;
+
+private:
+    std::vector<Mesh> levels_;
+};
+
+}  // namespace s21
+
+#endif  // MESH_LOD_H_
@@ -0,0 +1,212 @@
+// MESH_REORDER.CPP - Реализация перестановки вершин и ребер
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - Код Мортона: разнесение 10 бит оси через каждые 3 бита (маски)
+// - Параллельную сортировку uint64 ключей: блоки по потокам + попарное слияние
+// - Сбор координат и перевод индексов ребер блоками на ParallelFor
+// - Сортировку ребер подсчетом по первой вершине (O(ребер), без сравнений)
+// - Перевод индексов треугольников (нормали граней переносятся как есть)
+// - Замер прохода по концам ребер до и после перестановки
+
+#include "mesh_reorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <span>
+#include <utility>
+
+#include "model.h"     // Mesh, BoundingBox
+#include "parallel.h"  // ParallelFor, GetWorkerCount
+#include "profiler.h"
+
+namespace s21 {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t kBlock = 1u << 16;      // Вершин / ребер на задачу ParallelFor
+constexpr size_t kSortBlock = 1u << 18;  // Меньше - сортировка в одном потоке
+
+double millisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// abcdefghij -> a00b00c00d00e00f00g00h00i00j
+uint32_t spreadBits(uint32_t value) {
+    value &= 0x3ff;
+    value = (value | (value << 16)) & 0x030000ff;
+    value = (value | (value << 8)) & 0x0300f00f;
+    value = (value | (value << 4)) & 0x030c30c3;
+    value = (value | (value << 2)) & 0x09249249;
+    return value;
+}
+
+template <typename Fn>
+void forBlocks(size_t count, Fn&& fn) {
+    ParallelFor((count + kBlock - 1) / kBlock, [&](size_t block) {
+        size_t begin = block * kBlock;
+        fn(begin, std::min(count, begin + kBlock));
+    });
+}
+
+struct SweepResult {
+    double milliseconds = 0.0;
+    double mean_span = 0.0;
+};
+
+// Доступ как у проекции и отрисовки: x, y, z обоих концов каждого ребра
+SweepResult sweepEdges(const Mesh& mesh) {
+    std::span<const float> x = mesh.GetX(), y = mesh.GetY(), z = mesh.GetZ();
+    std::span<const uint32_t> edges = mesh.GetEdgeIndices();
+    Clock::time_point start = Clock::now();
+    float sum = 0.0f;
+    uint64_t span = 0;
+    for (size_t i = 0; i + 1 < edges.size(); i += 2) {
+        uint32_t begin = edges[i], end = edges[i + 1];
+        sum += x[begin] + y[begin] + z[begin] + x[end] + y[end] + z[end];
+        span += begin > end ? begin - end : end - begin;
+    }
+    SweepResult result;
+    result.milliseconds = millisecondsSince(start);
+    volatile float sink = sum;  // Цикл не должен быть выброшен оптимизатором
+    static_cast<void>(sink);
+    size_t edgeCount = edges.size() / 2;
+    result.mean_span = edgeCount ? double(span) / double(edgeCount) : 0.0;
+    return result;
+}
+
+}  // namespace
+
+ReorderStats MeshReorderer::Reorder(Mesh& mesh) {
+    ReorderStats stats;
+    stats.vertex_count = mesh.GetVertexCount();
+    stats.edge_count = mesh.GetEdgeCount();
+    if (stats.vertex_count < kMinVertices || stats.vertex_count >= UINT32_MAX ||
+        stats.edge_count >= UINT32_MAX || mesh.IsCompact()) {
+        return stats;
+    }
+    S21_PROFILE_SCOPE("read: reorder", kLoad);
+
+    SweepResult before = sweepEdges(mesh);
+    stats.mean_span_before = stats.mean_span_after = before.mean_span;
+    stats.sweep_before_ms = stats.sweep_after_ms = before.milliseconds;
+    if (before.mean_span <= kCoherentSpan) return stats;  // Порядок файла уже локален
+    Clock::time_point start = Clock::now();
+
+    // 1-2. Ключи вершин: код Мортона ячейки и старый индекс
+    std::span<const float> x = mesh.GetX(), y = mesh.GetY(), z = mesh.GetZ();
+    const size_t count = x.size();
+    BoundingBox bounds = mesh.ComputeBounds();
+    const float cells = float(1u << kGridBits);
+    const float origin[3] = {float(bounds.min.x), float(bounds.min.y), float(bounds.min.z)};
+    const float extent[3] = {float(bounds.max.x - bounds.min.x), float(bounds.max.y - bounds.min.y),
+                             float(bounds.max.z - bounds.min.z)};
+    float scale[3];
+    for (int axis = 0; axis < 3; ++axis) scale[axis] = extent[axis] > 0.0f ? cells / extent[axis] : 0.0f;
+    auto cellOf = [&](float value, int axis) {
+        float cell = (value - origin[axis]) * scale[axis];
+        return std::min(uint32_t(std::max(cell, 0.0f)), (1u << kGridBits) - 1);
+    };
+
+    keys_.resize(count);
+    forBlocks(count, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            uint32_t code = spreadBits(cellOf(x[i], 0)) | spreadBits(cellOf(y[i], 1)) << 1 |
+                            spreadBits(cellOf(z[i], 2)) << 2;
+            keys_[i] = uint64_t(code) << 32 | i;
+        }
+    });
+    sortKeys();
+
+    // 3. Координаты в новом порядке, таблица перевода индексов
+    std::vector<float> newX(count), newY(count), newZ(count);
+    remap_.resize(count);
+    forBlocks(count, [&](size_t begin, size_t end) {
+        for (size_t rank = begin; rank < end; ++rank) {
+            uint32_t old = uint32_t(keys_[rank]);
+            newX[rank] = x[old];
+            newY[rank] = y[old];
+            newZ[rank] = z[old];
+            remap_[old] = uint32_t(rank);
+        }
+    });
+
+    // 4. Ребра: новые индексы (min, max), затем сортировка подсчетом по первой
+    //    вершине; вторые вершины одной первой сортируются в своем диапазоне
+    std::span<const uint32_t> edges = mesh.GetEdgeIndices();
+    const size_t edgeCount = edges.size() / 2;
+    std::vector<uint32_t> newEdges(edgeCount * 2);
+    forBlocks(edgeCount, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            uint32_t a = remap_[edges[2 * i]], b = remap_[edges[2 * i + 1]];
+            newEdges[2 * i] = std::min(a, b);
+            newEdges[2 * i + 1] = std::max(a, b);
+        }
+    });
+    // Треугольники: только новые индексы, порядок и нормали граней не меняются
+    std::span<const uint32_t> triangles = mesh.GetTriangles();
+    std::vector<uint32_t> newTriangles(triangles.size());
+    forBlocks(triangles.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) newTriangles[i] = remap_[triangles[i]];
+    });
+    std::span<const float> normals = mesh.GetFaceNormals();
+    std::vector<float> keptNormals(normals.begin(), normals.end());
+
+    offsets_.assign(count + 1, 0);
+    for (size_t i = 0; i < edgeCount; ++i) ++offsets_[newEdges[2 * i] + 1];
+    for (size_t v = 0; v < count; ++v) offsets_[v + 1] += offsets_[v];
+    remap_.assign(offsets_.begin(), offsets_.end() - 1);  // Таблица больше не нужна - курсоры вершин
+    ends_.resize(edgeCount);
+    for (size_t i = 0; i < edgeCount; ++i) ends_[remap_[newEdges[2 * i]]++] = newEdges[2 * i + 1];
+    forBlocks(count, [&](size_t begin, size_t end) {
+        for (size_t v = begin; v < end; ++v) {
+            std::sort(ends_.begin() + offsets_[v], ends_.begin() + offsets_[v + 1]);
+            for (uint32_t k = offsets_[v]; k < offsets_[v + 1]; ++k) {
+                newEdges[2 * size_t(k)] = uint32_t(v);
+                newEdges[2 * size_t(k) + 1] = ends_[k];
+            }
+        }
+    });
+
+    mesh.SetPositions(std::move(newX), std::move(newY), std::move(newZ));
+    mesh.SetEdges(std::move(newEdges));
+    mesh.SetFaces(std::move(newTriangles), std::move(keptNormals));
+    stats.reorder_ms = millisecondsSince(start);
+
+    SweepResult after = sweepEdges(mesh);
+    stats.applied = true;
+    stats.mean_span_after = after.mean_span;
+    stats.sweep_after_ms = after.milliseconds;
+    return stats;
+}
+
+void MeshReorderer::sortKeys() {
+    const size_t count = keys_.size();
+    const size_t blocks = std::min<size_t>(GetWorkerCount(), (count + kSortBlock - 1) / kSortBlock);
+    if (blocks <= 1) {
+        std::sort(keys_.begin(), keys_.end());
+        return;
+    }
+    std::vector<size_t> bounds(blocks + 1);
+    for (size_t block = 0; block <= blocks; ++block) bounds[block] = count * block / blocks;
+    ParallelFor(blocks, [&](size_t block) {
+        std::sort(keys_.begin() + bounds[block], keys_.begin() + bounds[block + 1]);
+    });
+
+    // Слияние соседних отсортированных серий: ширина серии (в блоках) удваивается
+    scratch_.resize(count);
+    for (size_t width = 1; width < blocks; width *= 2) {
+        size_t pairs = (blocks + 2 * width - 1) / (2 * width);
+        ParallelFor(pairs, [&](size_t pair) {
+            size_t first = bounds[std::min(blocks, 2 * pair * width)];
+            size_t middle = bounds[std::min(blocks, (2 * pair + 1) * width)];
+            size_t last = bounds[std::min(blocks, (2 * pair + 2) * width)];
+            std::merge(keys_.begin() + first, keys_.begin() + middle, keys_.begin() + middle,
+                       keys_.begin() + last, scratch_.begin() + first);
+        });
+        keys_.swap(scratch_);
+    }
+}
+
+}  // namespace s21
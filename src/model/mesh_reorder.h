@@ -0,0 +1,91 @@
+// MESH_REORDER.H - Перестановка вершин и ребер для последовательного доступа к памяти
+//
+// ЗАЧЕМ НУЖЕН:
+// Вершины лежат в Mesh в порядке файла. У сканов и экспортов этот порядок
+// часто почти случайный: соседние ребра ссылаются на вершины в разных
+// концах массивов, и каждый конец ребра при проекции и отрисовке - промах
+// кэша. После перестановки близкие в пространстве вершины лежат рядом
+// в памяти, а ребра идут по возрастанию первой вершины.
+//
+// ЧТО СОДЕРЖИТ:
+// - VertexOrder - порядок вершин Mesh (файл / кривая Мортона), ключ кэша
+// - ReorderStats - результат: локальность и время прохода до и после
+// - MeshReorderer класс - перестановка (буферы сохраняются между загрузками)
+//
+// КАК РАБОТАЕТ:
+// 1. Координаты квантуются в решетку 1024^3 внутри границ модели, код
+//    Мортона (Z-кривая, 30 бит) - чередование битов x, y, z
+// 2. Ключ вершины: код << 32 | старый индекс - сортировка дает новый
+//    порядок (равные коды - в порядке файла, результат детерминирован)
+// 3. Координаты собираются в новом порядке, индексы ребер переводятся
+//    через таблицу "старый -> новый", ребро приводится к (min, max);
+//    индексы треугольников переводятся той же таблицей (порядок треугольников
+//    и обход вершин сохраняются - нормали граней остаются верными)
+// 4. Ребра сортируются по первой вершине подсчетом (число ребер каждой
+//    вершины -> смещения -> раскладка), внутри вершины - по второй
+// 5. Сортировка вершин параллельна: блоки сортируются на ParallelFor, затем
+//    сливаются попарно (std::merge) за log2(блоков) проходов; сбор координат,
+//    перевод индексов и сортировка внутри вершин - блоками на ParallelFor
+// 6. Замер: проход по концам всех ребер (чтение x, y, z, как в проекции
+//    и отрисовке) до и после перестановки; GetSpeedup() - отношение
+// 7. Не переставляются: модели меньше kMinVertices (помещаются в кэш) и
+//    модели, где среднее |begin - end| ребра не больше kCoherentSpan -
+//    концы ребер уже рядом в памяти (сетки, экспорт из редакторов), и
+//    Z-кривая с ее скачками между блоками сделала бы доступ только хуже
+//    и сжатые модели (mesh_codec.h): перестановка делается до сжатия
+//
+// Все в namespace s21
+
+#ifndef MESH_REORDER_H_
+#define MESH_REORDER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace s21 {
+
+class Mesh;
+
+enum class VertexOrder : uint32_t {
+    kFile = 0,    // Как в OBJ файле
+    kMorton = 1   // MeshReorderer
+};
+
+struct ReorderStats {
+    bool applied = false;            // false - модель мала или ее порядок уже локален
+    size_t vertex_count = 0;
+    size_t edge_count = 0;
+    double mean_span_before = 0.0;   // Среднее |begin - end| ребра, в вершинах
+    double mean_span_after = 0.0;
+    double sweep_before_ms = 0.0;    // Проход по концам ребер
+    double sweep_after_ms = 0.0;
+    double reorder_ms = 0.0;         // Сама перестановка (без замеров)
+
+    double GetSpeedup() const {
+        return applied && sweep_after_ms > 0.0 ? sweep_before_ms / sweep_after_ms : 1.0;
+    }
+};
+
+class MeshReorderer {
+public:
+    static constexpr size_t kMinVertices = 1u << 15;
+    static constexpr int kGridBits = 10;  // Бит квантования на ось
+    static constexpr double kCoherentSpan = 4096.0;  // 16 КБ массива координат
+
+    // Mesh не должен быть внешним (кэш) - иначе он будет скопирован
+    ReorderStats Reorder(Mesh& mesh);
+
+private:
+    std::vector<uint64_t> keys_;     // Ключи сортировки вершин
+    std::vector<uint64_t> scratch_;  // Буфер слияния
+    std::vector<uint32_t> remap_;    // Старый индекс -> новый, затем курсоры раскладки
+    std::vector<uint32_t> offsets_;  // Начало ребер каждой вершины (count + 1)
+    std::vector<uint32_t> ends_;     // Вторые вершины ребер, по первой вершине
+
+    void sortKeys();
+};
+
+}  // namespace s21
+
+#endif  // MESH_REORDER_H_
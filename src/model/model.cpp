@@ -3,27 +3,309 @@
 // ЧТО РЕАЛИЗУЕТ:
 // - Facade паттерн - упрощенный интерфейс для сложной подсистемы
 // - Загрузка OBJ файлов с парсингом вершин (v) и граней (f)
-// - Аффинные преобразования через TransformMatrixBuilder (используя s21_matrix+)
+// - Аффинные преобразования через TransformMatrixBuilder (Mat4 на стеке)
 // - Нормализация модели при загрузке (центрирование, масштабирование)
-// - Обработка ошибок и возврат FacadeOperationResult
+// - Обработка ошибок и возврат FacadeOperationResult (конструкторы - в конце файла)
 // - Работа с Scene, Mesh, Vertex, Edge классами
 //
 // КАК РАБОТАЕТ:
-// 1. LoadMesh() -> создает FileReader, парсит OBJ, создает Mesh, нормализует
-// 2. MoveMesh() -> создает матрицу перемещения и применяет к сцене
-// 3. RotateMesh() -> создает матрицу поворота и применяет к сцене
-// 4. ScaleScene() -> создает матрицу масштабирования и применяет к сцене
+// 1. LoadMesh() -> FileReader (создан в конструкторе) парсит OBJ, создает Mesh, нормализует
+// 2. MoveMesh() -> создает матрицу перемещения и накапливает в матрице модели
+// 3. RotateMesh() -> создает матрицу поворота и накапливает в матрице модели
+// 4. ScaleScene() -> создает матрицу масштабирования и накапливает в матрице модели
+// 5. GetWorldMesh() -> лениво применяет матрицу модели к копии mesh'а (кэш)
+// 6. Mesh::SetVertexPrecision() -> сжатие координат и ребер (mesh_codec.h),
+//    detach() раскодирует их обратно при изменении mesh'а
+// 7. GetSnapshot() -> указатели на mesh, ускорители и сцену + матрица модели;
+//    правки сцены после снимка идут в копию (editScene)
 
 #include "model.h"
+
+#include <algorithm>
+#include <cmath>
+
 #include "geometry.h"  // TransformMatrixBuilder, TransformMatrix
+#include "transform_kernel.h"  // TransformPositions, ComputePositionBounds
+#include "io.h"                // FileReader, NormalizationParameters
+#include "mesh_loader.h"       // MeshLoadTask
+#include "mesh_lod.h"          // MeshLodChain
+#include "edge_grid.h"         // EdgeGrid
+#include "scene.h"             // Scene, GeometryCache
+#include "profiler.h"          // S21_PROFILE_SCOPE
+#include "parallel.h"          // ParallelFor
+
+namespace s21 {
+
+// ====== Mesh ======
+
+namespace {
+
+constexpr size_t kNormalBlock = 1u << 16;  // Треугольников в одной параллельной задаче
+constexpr size_t kDecodeBlock = 1u << 16;  // Вершин сжатого mesh'а в одной параллельной задаче
+
+// Центрирование и равномерный масштаб не меняют направления нормалей
+bool keepsNormals(const Mat4& m) {
+    return m(0, 1) == 0.0 && m(0, 2) == 0.0 && m(1, 0) == 0.0 && m(1, 2) == 0.0 &&
+           m(2, 0) == 0.0 && m(2, 1) == 0.0 && m(0, 0) > 0.0 && m(0, 0) == m(1, 1) &&
+           m(1, 1) == m(2, 2) && m(3, 0) == 0.0 && m(3, 1) == 0.0 && m(3, 2) == 0.0;
+}
+
+}  // namespace
+
+void Mesh::Transform(const TransformMatrix& matrix) {
+    detach();
+    // Пакетное ядро (AVX2/SSE2/scalar по CPU) по массивам координат
+    float m[16];
+    matrix.ToFloatArray(m);
+    TransformPositions(m, x_.data(), y_.data(), z_.data(), x_.size());
+    if (!triangles_.empty() && !keepsNormals(matrix.GetMat4())) UpdateFaceNormals();
+}
+
+BoundingBox Mesh::ComputeBounds() const {
+    std::span<const float> x = GetX(), y = GetY(), z = GetZ();
+    if (GetVertexCount() == 0) return BoundingBox{};
+    float min[3], max[3];
+    if (compact_) {
+        compact_->positions.GetBounds(min, max);  // Без прохода по вершинам
+    } else {
+        // Один проход по каждому массиву: SIMD min/max, блоки параллельно
+        ComputePositionBounds(x.data(), y.data(), z.data(), x.size(), min, max);
+    }
+    return BoundingBox{Point3D{min[0], min[1], min[2]}, Point3D{max[0], max[1], max[2]}};
+}
+
+void Mesh::Reserve(size_t vertexCount, size_t edgeCount) {
+    detach();
+    x_.reserve(vertexCount);
+    y_.reserve(vertexCount);
+    z_.reserve(vertexCount);
+    edges_.reserve(edgeCount * 2);
+}
+
+void Mesh::AddVertex(const Point3D& position) {
+    detach();
+    x_.push_back(static_cast<float>(position.x));
+    y_.push_back(static_cast<float>(position.y));
+    z_.push_back(static_cast<float>(position.z));
+}
+
+void Mesh::AddEdge(size_t begin_index, size_t end_index) {
+    detach();
+    edges_.push_back(static_cast<uint32_t>(begin_index));
+    edges_.push_back(static_cast<uint32_t>(end_index));
+}
+
+void Mesh::SetEdges(std::vector<uint32_t>&& edges) {
+    detach();
+    edges_ = std::move(edges);
+}
+
+void Mesh::SetPositions(std::vector<float>&& x, std::vector<float>&& y, std::vector<float>&& z) {
+    detach();
+    x_ = std::move(x);
+    y_ = std::move(y);
+    z_ = std::move(z);
+}
+
+void Mesh::SetTriangles(std::vector<uint32_t>&& triangles) {
+    detach();
+    triangles_ = std::move(triangles);
+    UpdateFaceNormals();
+}
+
+void Mesh::SetFaces(std::vector<uint32_t>&& triangles, std::vector<float>&& normals) {
+    detach();
+    triangles_ = std::move(triangles);
+    face_normals_ = std::move(normals);
+}
+
+// Нормаль - векторное произведение (b - a) x (c - a); вырожденный треугольник - нулевая
+void Mesh::UpdateFaceNormals() {
+    detach();
+    const size_t count = triangles_.size() / 3;
+    face_normals_.resize(count * 3);
+    ParallelFor((count + kNormalBlock - 1) / kNormalBlock, [&](size_t block) {
+        size_t end = std::min(count, (block + 1) * kNormalBlock);
+        for (size_t t = block * kNormalBlock; t < end; ++t) {
+            const uint32_t a = triangles_[t * 3], b = triangles_[t * 3 + 1], c = triangles_[t * 3 + 2];
+            float ux = x_[b] - x_[a], uy = y_[b] - y_[a], uz = z_[b] - z_[a];
+            float vx = x_[c] - x_[a], vy = y_[c] - y_[a], vz = z_[c] - z_[a];
+            float nx = uy * vz - uz * vy, ny = uz * vx - ux * vz, nz = ux * vy - uy * vx;
+            float length = std::sqrt(nx * nx + ny * ny + nz * nz);
+            float inverse = length > 0.0f ? 1.0f / length : 0.0f;
+            face_normals_[t * 3] = nx * inverse;
+            face_normals_[t * 3 + 1] = ny * inverse;
+            face_normals_[t * 3 + 2] = nz * inverse;
+        }
+    });
+}
+
+void Mesh::AdoptExternal(std::shared_ptr<const void> owner,
+                         std::span<const float> x, std::span<const float> y,
+                         std::span<const float> z, std::span<const uint32_t> edges,
+                         std::span<const uint32_t> triangles, std::span<const float> normals) {
+    x_.clear();
+    y_.clear();
+    z_.clear();
+    edges_.clear();
+    triangles_.clear();
+    face_normals_.clear();
+    compact_.reset();
+    external_ = std::move(owner);
+    external_x_ = x;
+    external_y_ = y;
+    external_z_ = z;
+    external_edges_ = edges;
+    external_triangles_ = triangles;
+    external_normals_ = normals;
+}
+
+void Mesh::SetVertexPrecision(VertexPrecision precision) {
+    if (precision == GetVertexPrecision()) return;
+    detach();  // Из другой точности - через float
+    if (precision == VertexPrecision::kFloat) return;
+    
+    auto compact = std::make_shared<CompactGeometry>();
+    compact->positions = QuantizedPositions::Encode(x_, y_, z_, precision);
+    compact->edges = EdgeStream::Encode(edges_);
+    compact_ = std::move(compact);
+    // Память отдается сразу (clear сохранил бы емкость)
+    std::vector<float>().swap(x_);
+    std::vector<float>().swap(y_);
+    std::vector<float>().swap(z_);
+    std::vector<uint32_t>().swap(edges_);
+}
+
+PositionPointers Mesh::ReadPositions(size_t first, size_t count, PositionChunk& chunk,
+                                     size_t stride) const {
+    if (compact_) {
+        if (stride == 1) {
+            compact_->positions.Decode(first, count, chunk.x, chunk.y, chunk.z);
+        } else {
+            compact_->positions.Gather(first, count, stride, chunk.x, chunk.y, chunk.z);
+        }
+        return PositionPointers{chunk.x, chunk.y, chunk.z};
+    }
+    const float *x = GetX().data(), *y = GetY().data(), *z = GetZ().data();
+    if (stride == 1) return PositionPointers{x + first, y + first, z + first};
+    for (size_t i = 0; i < count; ++i) {
+        size_t source = first + i * stride;
+        chunk.x[i] = x[source], chunk.y[i] = y[source], chunk.z[i] = z[source];
+    }
+    return PositionPointers{chunk.x, chunk.y, chunk.z};
+}
+
+size_t Mesh::GetMemoryBytes() const {
+    size_t bytes = (x_.capacity() + y_.capacity() + z_.capacity() + face_normals_.capacity()) * sizeof(float) +
+                   (edges_.capacity() + triangles_.capacity()) * sizeof(uint32_t);
+    if (compact_) bytes += compact_->positions.GetMemoryBytes() + compact_->edges.GetMemoryBytes();
+    return bytes;
+}
+
+void Mesh::detach() {
+    if (compact_) {
+        // Сжатый mesh не бывает внешним: грани уже в собственных массивах
+        const CompactGeometry& compact = *compact_;
+        const size_t count = compact.positions.GetCount();
+        x_.resize(count);
+        y_.resize(count);
+        z_.resize(count);
+        ParallelFor((count + kDecodeBlock - 1) / kDecodeBlock, [&](size_t block) {
+            size_t first = block * kDecodeBlock;
+            compact.positions.Decode(first, std::min(kDecodeBlock, count - first), x_.data() + first,
+                                     y_.data() + first, z_.data() + first);
+        });
+        compact.edges.DecodeAll(edges_);
+        compact_.reset();
+        return;
+    }
+    if (!external_) return;
+    x_.assign(external_x_.begin(), external_x_.end());
+    y_.assign(external_y_.begin(), external_y_.end());
+    z_.assign(external_z_.begin(), external_z_.end());
+    edges_.assign(external_edges_.begin(), external_edges_.end());
+    triangles_.assign(external_triangles_.begin(), external_triangles_.end());
+    face_normals_.assign(external_normals_.begin(), external_normals_.end());
+    external_.reset();
+    external_x_ = external_y_ = external_z_ = {};
+    external_edges_ = {};
+    external_triangles_ = {};
+    external_normals_ = {};
+}
+
+// ====== Model ======
+
+Model::Model() { initializeServices(); }
+
+// Определен здесь: MeshLoadTask в model.h только объявлен
+Model::~Model() = default;
+
+void Model::initializeServices() {
+    file_reader_ = std::make_unique<FileReader>();
+    async_reader_ = std::make_unique<FileReader>();
+    geometry_cache_ = std::make_unique<GeometryCache>();
+}
+
+FacadeOperationResult Model::LoadMesh(const std::string& path) {
+    FacadeOperationResult result = file_reader_->ReadMesh(path, NormalizationParameters());
+    if (result.IsError()) return result;
+    
+    auto mesh = std::make_shared<Mesh>(result.TakeMesh());
+    accelerators_ = {};
+    BuildMeshAccelerators(*mesh, accelerators_);
+    mesh_ = std::move(mesh);
+    ++mesh_version_;
+    resetModelMatrix();
+    return FacadeOperationResult(true, result.GetErrorMessage());
+}
+
+FacadeOperationResult Model::LoadMeshAsync(const std::string& path, MeshLoadHandlers handlers) {
+    load_task_.reset();  // Отмена и ожидание предыдущей загрузки
+    load_task_ = std::make_unique<MeshLoadTask>(path, NormalizationParameters(), *async_reader_,
+                                                std::move(handlers));
+    load_task_->SetVertexPrecision(vertex_precision_);
+    load_task_->Start();
+    return FacadeOperationResult(true, "Loading started");
+}
+
+void Model::SetVertexPrecision(VertexPrecision precision) {
+    vertex_precision_ = precision;
+    file_reader_->SetVertexPrecision(precision);  // LoadMesh и объекты сцены
+}
+
+void Model::SetCacheDirectory(const std::string& directory) {
+    for (FileReader* reader : {file_reader_.get(), async_reader_.get()}) {
+        reader->SetCacheEnabled(!directory.empty());
+        reader->SetCacheDirectory(directory);
+    }
+}
+
+void Model::CancelLoading() {
+    if (load_task_) load_task_->Cancel();
+}
+
+void Model::StopLoading() {
+    load_task_.reset();
+}
+
+bool Model::IsLoading() const {
+    return load_task_ && !load_task_->IsFinished();
+}
+
+void Model::SetLoadedMesh(Mesh mesh, MeshAccelerators accelerators) {
+    mesh_ = std::make_shared<const Mesh>(std::move(mesh));
+    ++mesh_version_;
+    accelerators_ = std::move(accelerators);
+    resetModelMatrix();
+}
 
 FacadeOperationResult Model::MoveMesh(double x, double y, double z) {
 
         // 1. Создает матрицу перемещения
         TransformMatrix matrix = TransformMatrixBuilder::CreateMoveMatrix(x, y, z);
         
-        // 2. Применяет к сцене
-        mesh_.Transform(matrix);
+        // 2. Накапливает в матрице модели (вершины не трогаются)
+        applyTransform(matrix);
         
         return FacadeOperationResult(true, "Move successful");
         
@@ -35,8 +317,8 @@ FacadeOperationResult Model::RotateMesh(double x, double y, double z) {
         // 1. Создает матрицу поворота
         TransformMatrix matrix = TransformMatrixBuilder::CreateRotationMatrix(x, y, z);
         
-        // 2. Применяет к сцене
-        mesh_.Transform(matrix);
+        // 2. Накапливает в матрице модели (вершины не трогаются)
+        applyTransform(matrix);
         
         return FacadeOperationResult(true, "Rotation successful");
         
@@ -48,9 +330,111 @@ FacadeOperationResult Model::ScaleMesh(double x, double y, double z) {
         // 1. Создает матрицу масштабирования
         TransformMatrix matrix = TransformMatrixBuilder::CreateScaleMatrix(x, y, z);
         
-        // 2. Применяет к сцене
-        mesh_.Transform(matrix);
+        // 2. Накапливает в матрице модели (вершины не трогаются)
+        applyTransform(matrix);
         
         return FacadeOperationResult(true, "Scaling successful");
     
 }
+
+FacadeOperationResult Model::TransformMesh(const TransformMatrix& matrix) {
+    applyTransform(matrix);
+    return FacadeOperationResult(true, "Transform successful");
+}
+
+FacadeOperationResult Model::AddObject(const std::string& path, const TransformMatrix& transform,
+                                       ObjectId* id) {
+    ensureScene();
+    GeometryHandle geometry;
+    FacadeOperationResult result = geometry_cache_->Acquire(path, *file_reader_, geometry);
+    if (result.IsError()) return result;
+    
+    ObjectId added = editScene().AddObject(std::move(geometry), transform);
+    if (id) *id = added;
+    return FacadeOperationResult(true, "Object added");
+}
+
+FacadeOperationResult Model::RemoveObject(ObjectId id) {
+    if (!scene_ || !editScene().RemoveObject(id)) return FacadeOperationResult(false, "Object not found");
+    return FacadeOperationResult(true, "Object removed");
+}
+
+FacadeOperationResult Model::TransformObject(ObjectId id, const TransformMatrix& step) {
+    if (!scene_ || !editScene().TransformObject(id, step)) {
+        return FacadeOperationResult(false, "Object not found");
+    }
+    return FacadeOperationResult(true, "Transform successful");
+}
+
+void Model::ClearScene() {
+    if (scene_) editScene().Clear();  // Кэш геометрии освобождается вместе с объектами
+}
+
+const Scene& Model::GetScene() const {
+    static const Scene kEmpty;
+    return scene_ ? *scene_ : kEmpty;
+}
+
+void Model::ensureScene() {
+    if (!scene_) scene_ = std::make_shared<Scene>();
+}
+
+// Снимок держит свою ссылку на сцену: следующая правка сначала копирует ее
+// (объекты - указатели на геометрию и матрицы, копия дешевая)
+Scene& Model::editScene() {
+    if (scene_.use_count() > 1) scene_ = std::make_shared<Scene>(*scene_);
+    return *scene_;
+}
+
+ModelSnapshot Model::GetSnapshot() const {
+    ModelSnapshot snapshot;
+    snapshot.mesh = mesh_;
+    snapshot.mesh_version = mesh_version_;
+    snapshot.accelerators = accelerators_;
+    snapshot.model_matrix = model_matrix_;
+    snapshot.matrix_version = matrix_version_;
+    snapshot.scene = scene_;
+    return snapshot;
+}
+
+const Mesh& Model::GetWorldMesh() const {
+    updateWorldCache();
+    return world_mesh_;
+}
+
+BoundingBox Model::GetWorldBounds() const {
+    updateWorldCache();
+    return world_bounds_;
+}
+
+void Model::applyTransform(const TransformMatrix& matrix) {
+    S21_PROFILE_SCOPE("model: transform", kTransform);
+    // Новая операция применяется после уже накопленных
+    model_matrix_ = matrix.Multiply(model_matrix_);
+    ++matrix_version_;
+}
+
+void Model::resetModelMatrix() {
+    model_matrix_ = TransformMatrixBuilder::CreateIdentityMatrix();
+    ++matrix_version_;
+    world_mesh_ = Mesh();
+}
+
+void Model::updateWorldCache() const {
+    if (world_version_ == matrix_version_) return;
+    S21_PROFILE_SCOPE("model: world cache", kTransform);
+    world_mesh_ = *mesh_;
+    world_mesh_.Transform(model_matrix_);
+    world_bounds_ = world_mesh_.ComputeBounds();
+    world_version_ = matrix_version_;
+}
+
+// ====== FacadeOperationResult ======
+
+FacadeOperationResult::FacadeOperationResult(bool success, const std::string& message)
+    : success_(success), message_(message) {}
+
+FacadeOperationResult::FacadeOperationResult(bool success, const std::string& message, Mesh mesh)
+    : success_(success), message_(message), mesh_(std::move(mesh)) {}
+
+}  // namespace s21
@@ -7,63 +7,204 @@
 //
 // ЧТО СОДЕРЖИТ:
 // - Класс Model как Facade для всей подсистемы
-// - Агрегирует: FileReader (загрузка), NormalizationService (нормализация), Mesh (данные)
+// - Агрегирует: FileReader (загрузка и нормализация), GeometryCache (сцена), Mesh (данные)
 // - Упрощенный интерфейс: LoadMesh(), MoveMesh(), RotateMesh(), ScaleMesh()
 // - Возвращает FacadeOperationResult для всех операций (успех/ошибка)
 // - Управление стратегиями трансформации (Strategy паттерн)
 // - Работа с TransformMatrix для аффинных преобразований
-// - Загрузка OBJ файлов через FileReader
-// - Нормализация mesh'а через NormalizationService
+// - Загрузка и нормализация OBJ файлов через FileReader
 // - Управление Mesh объектами (Vertex, Edge)
 //
 // ЧТО ПРОИСХОДИТ:
 // 1. Пользователь нажимает "Загрузить файл" -> Controller вызывает model.LoadMesh()
 // 2. Model делегирует загрузку FileReader'у, получает Mesh
-// 3. Model делегирует нормализацию NormalizationService'у
+// 3. FileReader нормализует Mesh до возврата (центрирование, масштаб)
 // 4. Пользователь поворачивает модель -> Controller вызывает model.RotateMesh()
-// 5. Model создает матрицу поворота и применяет к mesh'у
-// 6. View запрашивает отрисовку -> Model возвращает mesh'а
+// 5. Model создает матрицу поворота и домножает на нее матрицу модели (O(1))
+// 2a. Для больших файлов Controller вызывает model.LoadMeshAsync(): загрузка идет
+//     в MeshLoadTask (рабочий поток), черновые Mesh и прогресс уходят в View,
+//     результат принимается через SetLoadedMesh() в GUI потоке
+// 6. View запрашивает отрисовку -> Model возвращает исходный mesh и матрицу модели,
+//    матрица применяется при проекции
+// 7. Для больших моделей при загрузке строится цепочка упрощенных mesh'ей
+//    (MeshLodChain); View рисует грубый уровень, пока идет ввод мышью
+// 8. Для больших моделей при загрузке строится индекс ребер (EdgeGrid);
+//    View рисует только ребра ячеек, попавших в область вывода
+// 9. Сборки: AddObject() добавляет в сцену (scene.h) объект со своей матрицей;
+//    геометрия одного файла загружается один раз (GeometryCache) и разделяется
+//    всеми его объектами. Матрица модели действует на mesh_ и на всю сцену
+//
+// ОТЛОЖЕННЫЕ ТРАНСФОРМАЦИИ:
+// Вершины mesh_ после загрузки не меняются. Move/Rotate/Scale только
+// накапливают model_matrix_ (новая операция применяется после предыдущих).
+// Мировые координаты (экспорт, границы) считаются лениво в GetWorldMesh()
+// и кэшируются до следующего изменения матрицы. Исходные данные не
+// накапливают ошибку округления при долгом вращении.
+//
+// СНИМОК ДЛЯ ОТРИСОВКИ:
+// mesh_ хранится как MeshHandle (shared_ptr<const Mesh>): загрузка заменяет
+// указатель и увеличивает mesh_version_, сам Mesh после публикации не
+// меняется. Сцена меняется копией при записи (editScene). GetSnapshot()
+// собирает указатели и матрицу модели в ModelSnapshot - поток отрисовки
+// (view/render_pipeline.h) читает его без блокировок, пока GUI поток
+// продолжает менять Model.
 //
 // Все в namespace s21
 
-#include "geometry.h"  // 3DPoint, TransformMatrix
+#ifndef MODEL_H_
+#define MODEL_H_
+
+#include <QColor>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "geometry.h"    // Point3D, TransformMatrix
+#include "mesh_codec.h"  // CompactGeometry, VertexPrecision, PositionChunk
 
 namespace s21 {
 
+class FacadeOperationResult;  // Ниже: хранит Mesh по значению
+class FileReader;             // io.h
+
 // Структуры данных модели
+//
+// ХРАНЕНИЕ (structure-of-arrays):
+// Mesh хранит координаты вершин тремя непрерывными массивами float (x_, y_, z_),
+// а ребра - одним массивом пар индексов uint32_t (edges_ = b0 e0 b1 e1 ...).
+// 12 байт на вершину и 8 байт на ребро вместо объектов с double и указателями;
+// индексы не инвалидируются при реаллокации, а трансформация и отрисовка
+// проходят по памяти линейно.
+// Vertex и Edge - легкие представления (view) над этим хранилищем.
+//
+// ГРАНИ:
+// Грани OBJ хранятся триангулированными (веером от первой вершины) -
+// triangles_ = a0 b0 c0 a1 b1 c1 ... (порядок обхода файла: против часовой
+// стрелки - лицевая сторона), и нормаль каждого треугольника -
+// face_normals_ = nx0 ny0 nz0 ... (единичная, по обходу). Нормали
+// пересчитываются при SetTriangles() и Transform(); SetFaces() принимает
+// готовые (кэш, перестановка вершин). Mesh без граней (уровни LOD,
+// черновой) - только каркас; без граней и ребер - облако точек
+// (IsPointCloud), хранит только x, y, z - 12 байт на точку.
+//
+// СЖАТОЕ ХРАНИЛИЩЕ (по выбору, mesh_codec.h):
+// SetVertexPrecision(kBits16 / kBits21) заменяет x_, y_, z_ и edges_
+// квантованными координатами (6 или 8 байт на вершину) и ребрами,
+// закодированными разностями (2-4 байта на ребро после перестановки
+// Мортона); грани и нормали не сжимаются. GetX() / GetEdgeIndices() у
+// такого mesh'а пусты: проекция и отрисовка читают вершины кусками через
+// ReadPositions(), ребра - блоками GetCompact()->edges. Изменяющая
+// операция (Transform и т.д.) раскодирует данные обратно во float.
+//
+// ВНЕШНЕЕ ХРАНИЛИЩЕ:
+// Mesh может ссылаться на чужую память (например, отображенный файл кэша,
+// MeshCache) без копирования - AdoptExternal(). Владелец памяти хранится в
+// external_. Любая изменяющая операция сначала копирует данные в собственные
+// массивы (detach, copy-on-write).
+class Mesh;
+
 class Vertex {
 public:
-    Vertex(const 3DPoint& position) : position_(position) {}
-    void Transform(const TransformMatrix& matrix);
-    const 3DPoint& GetPosition() const { return position_; }
+    Vertex(const Mesh& mesh, uint32_t index) : mesh_(&mesh), index_(index) {}
+    Point3D GetPosition() const;
+    uint32_t GetIndex() const { return index_; }
     
 private:
-    3DPoint position_;
+    const Mesh* mesh_;
+    uint32_t index_;
 };
 
 class Edge {
 public:
-    Edge(Vertex* begin, Vertex* end) : begin_(begin), end_(end) {}
-    Vertex* GetBegin() const { return begin_; }
-    Vertex* GetEnd() const { return end_; }
+    Edge(uint32_t begin, uint32_t end) : begin_(begin), end_(end) {}
+    uint32_t GetBegin() const { return begin_; }  // Индекс вершины в Mesh
+    uint32_t GetEnd() const { return end_; }
     
 private:
-    Vertex* begin_;
-    Vertex* end_;
+    uint32_t begin_;
+    uint32_t end_;
 };
 
 class Mesh {
 public:
     void Transform(const TransformMatrix& matrix);
-    void AddVertex(const 3DPoint& position);
+    BoundingBox ComputeBounds() const;
+    void Reserve(size_t vertexCount, size_t edgeCount);
+    void AddVertex(const Point3D& position);
     void AddEdge(size_t begin_index, size_t end_index);
+    void SetEdges(std::vector<uint32_t>&& edges); // b0 e0 b1 e1 ...
+    void SetPositions(std::vector<float>&& x, std::vector<float>&& y,
+                      std::vector<float>&& z);     // Готовые массивы координат (одной длины)
+    void SetTriangles(std::vector<uint32_t>&& triangles);  // a0 b0 c0 ...; нормали по координатам
+    void SetFaces(std::vector<uint32_t>&& triangles,
+                  std::vector<float>&& normals);   // Нормали уже посчитаны (3 на треугольник)
+    void UpdateFaceNormals();
+    
+    // Данные во внешней памяти; owner держит ее живой, пока жив Mesh (и его копии)
+    void AdoptExternal(std::shared_ptr<const void> owner,
+                       std::span<const float> x, std::span<const float> y,
+                       std::span<const float> z, std::span<const uint32_t> edges,
+                       std::span<const uint32_t> triangles = {},
+                       std::span<const float> normals = {});
+    bool IsExternal() const { return external_ != nullptr; }
+    
+    // Сжатое хранение координат и ребер; kFloat - обратно в массивы float
+    void SetVertexPrecision(VertexPrecision precision);
+    VertexPrecision GetVertexPrecision() const {
+        return compact_ ? compact_->positions.GetPrecision() : VertexPrecision::kFloat;
+    }
+    bool IsCompact() const { return compact_ != nullptr; }
+    const CompactGeometry* GetCompact() const { return compact_.get(); }
+    // Ключ хранилища координат для кэшей View: меняется вместе с буферами
+    const void* GetStorageKey() const {
+        return compact_ ? static_cast<const void*>(compact_.get()) : GetX().data();
+    }
+    // Координаты вершин first, first + stride, ... (count <= PositionChunk::kSize):
+    // массивы float подряд - указатели на них, иначе копия в chunk
+    PositionPointers ReadPositions(size_t first, size_t count, PositionChunk& chunk,
+                                   size_t stride = 1) const;
+    void ReadPosition(size_t index, float out[3]) const;
+    size_t GetMemoryBytes() const;  // Собственные массивы (без внешней памяти)
     
     // Информация о модели
     std::string GetFilename() const { return filename_; }
-    size_t GetVertexCount() const { return vertices_.size(); }
-    size_t GetEdgeCount() const { return edges_.size(); }
-    const std::vector<Vertex>& GetVertices() const { return vertices_; }
-    const std::vector<Edge>& GetEdges() const { return edges_; }
+    size_t GetVertexCount() const {
+        return compact_ ? compact_->positions.GetCount() : GetX().size();
+    }
+    size_t GetEdgeCount() const {  // Уникальные ребра
+        return compact_ ? compact_->edges.GetEdgeCount() : GetEdgeIndices().size() / 2;
+    }
+    size_t GetTriangleCount() const { return GetTriangles().size() / 3; }
+    bool HasFaces() const { return !GetTriangles().empty(); }
+    // Только вершины (скан LiDAR и т.п.) - рисуется PointCloudStrategy
+    bool IsPointCloud() const { return GetEdgeCount() == 0 && GetVertexCount() > 0; }
+    Vertex GetVertex(size_t index) const { return Vertex(*this, static_cast<uint32_t>(index)); }
+    Edge GetEdge(size_t index) const {
+        if (compact_) {
+            uint32_t begin, end;
+            compact_->edges.GetEdge(index, begin, end);
+            return Edge(begin, end);
+        }
+        std::span<const uint32_t> edges = GetEdgeIndices();
+        return Edge(edges[index * 2], edges[index * 2 + 1]);
+    }
+    
+    // Прямой доступ к хранилищу (для пакетной обработки и отрисовки)
+    std::span<const float> GetX() const { return external_ ? external_x_ : std::span<const float>(x_); }
+    std::span<const float> GetY() const { return external_ ? external_y_ : std::span<const float>(y_); }
+    std::span<const float> GetZ() const { return external_ ? external_z_ : std::span<const float>(z_); }
+    std::span<const uint32_t> GetEdgeIndices() const {  // b0 e0 b1 e1 ...
+        return external_ ? external_edges_ : std::span<const uint32_t>(edges_);
+    }
+    std::span<const uint32_t> GetTriangles() const {    // a0 b0 c0 a1 b1 c1 ...
+        return external_ ? external_triangles_ : std::span<const uint32_t>(triangles_);
+    }
+    std::span<const float> GetFaceNormals() const {     // nx0 ny0 nz0 ...
+        return external_ ? external_normals_ : std::span<const float>(face_normals_);
+    }
     
     // Настройки отображения
     void SetLineColor(const QColor& color) { line_color_ = color; }
@@ -71,14 +212,75 @@ public:
     void SetLineWidth(int width) { line_width_ = width; }
     
 private:
-    std::vector<Vertex> vertices_;
-    std::vector<Edge> edges_;
+    std::vector<float> x_;
+    std::vector<float> y_;
+    std::vector<float> z_;
+    std::vector<uint32_t> edges_;
+    std::vector<uint32_t> triangles_;
+    std::vector<float> face_normals_;
     std::string filename_;
+    std::shared_ptr<const CompactGeometry> compact_;  // Вместо x_, y_, z_, edges_ (копии разделяют)
+    
+    // Внешнее хранилище (только чтение)
+    std::shared_ptr<const void> external_;
+    std::span<const float> external_x_;
+    std::span<const float> external_y_;
+    std::span<const float> external_z_;
+    std::span<const uint32_t> external_edges_;
+    std::span<const uint32_t> external_triangles_;
+    std::span<const float> external_normals_;
     
     // Настройки отображения
     QColor line_color_;
     QColor vertex_color_;
     int line_width_;
+    
+    void detach(); // Копирует внешние или раскодирует сжатые данные в собственные массивы
+};
+
+inline void Mesh::ReadPosition(size_t index, float out[3]) const {
+    if (compact_) {
+        compact_->positions.DecodeOne(index, out);
+        return;
+    }
+    out[0] = GetX()[index];
+    out[1] = GetY()[index];
+    out[2] = GetZ()[index];
+}
+
+inline Point3D Vertex::GetPosition() const {
+    float position[3];
+    mesh_->ReadPosition(index_, position);
+    return Point3D{position[0], position[1], position[2]};
+}
+
+class MeshLoadTask;
+struct MeshLoadHandlers;
+class MeshLodChain;
+class EdgeGrid;
+class Scene;
+class GeometryCache;
+
+using ObjectId = uint32_t;  // Объект сцены (scene.h)
+
+// Структуры для отрисовки больших моделей, строятся при загрузке (в потоке
+// загрузки); пустые указатели - ошибка или отмена
+struct MeshAccelerators {
+    std::shared_ptr<const MeshLodChain> lods;  // mesh_lod.h
+    std::shared_ptr<const EdgeGrid> edge_grid; // edge_grid.h
+};
+
+using MeshHandle = std::shared_ptr<const Mesh>;  // Неизменяемый после публикации
+
+// Состояние Model на момент GetSnapshot(): все данные по общим указателям,
+// Model их больше не меняет (новая загрузка или правка сцены создают новые)
+struct ModelSnapshot {
+    MeshHandle mesh;                      // Не nullptr (пустой Mesh до загрузки)
+    uint64_t mesh_version = 0;
+    MeshAccelerators accelerators;
+    TransformMatrix model_matrix;
+    uint64_t matrix_version = 0;
+    std::shared_ptr<const Scene> scene;   // nullptr - сцены нет
 };
 
 // Model = Facade для сложной подсистемы
@@ -88,13 +290,53 @@ public:
     ~Model();
     
     FacadeOperationResult LoadMesh(const std::string& path);
+    
+    // Фоновая загрузка (mesh_loader.h). Предыдущая незавершенная загрузка отменяется.
+    // Обработчики вызываются в рабочем потоке; готовый Mesh передается в SetLoadedMesh().
+    FacadeOperationResult LoadMeshAsync(const std::string& path, MeshLoadHandlers handlers);
+    void CancelLoading();   // Текущий mesh_ не меняется
+    void StopLoading();     // Отмена и ожидание рабочего потока: обработчики больше не вызываются
+    bool IsLoading() const;
+    // Хранение следующих загруженных моделей (mesh_codec.h); текущий mesh_ не меняется
+    void SetVertexPrecision(VertexPrecision precision);
+    VertexPrecision GetVertexPrecision() const { return vertex_precision_; }
+    // Бинарный кэш (mesh_cache.h) для LoadMesh, LoadMeshAsync и объектов сцены;
+    // пустая строка (по умолчанию) - кэш выключен, рядом с исходником ничего не пишется.
+    // Вызывается до загрузок: рабочий поток LoadMeshAsync читает свой FileReader
+    void SetCacheDirectory(const std::string& directory);
+    void SetLoadedMesh(Mesh mesh, MeshAccelerators accelerators = {});
     FacadeOperationResult MoveMesh(double x, double y, double z);
     FacadeOperationResult RotateMesh(double x, double y, double z);
     FacadeOperationResult ScaleMesh(double x, double y, double z);
+    // Готовая (например, составная из нескольких шагов ввода) трансформация
+    FacadeOperationResult TransformMesh(const TransformMatrix& matrix);
+    
+    // Сцена из многих объектов с общей геометрией (scene.h)
+    FacadeOperationResult AddObject(const std::string& path,
+                                    const TransformMatrix& transform = TransformMatrix(),
+                                    ObjectId* id = nullptr);
+    FacadeOperationResult RemoveObject(ObjectId id);
+    FacadeOperationResult TransformObject(ObjectId id, const TransformMatrix& step);
+    void ClearScene();
+    const Scene& GetScene() const;
     
     // Информация о mesh'е
-    bool HasMesh() const { return !mesh_.GetVertices().empty(); }
-    const Mesh& GetMesh() const { return mesh_; }
+    bool HasMesh() const { return mesh_->GetVertexCount() > 0; }
+    const Mesh& GetMesh() const { return *mesh_; }             // Исходные (локальные) координаты
+    uint64_t GetMeshVersion() const { return mesh_version_; }  // Растет при каждой загрузке
+    // Для отрисовки в другом потоке (копируются только указатели и матрица)
+    ModelSnapshot GetSnapshot() const;
+    const TransformMatrix& GetModelMatrix() const { return model_matrix_; }
+    // Упрощенные версии mesh_ для интерактивной отрисовки (mesh_lod.h);
+    // nullptr или пустая цепочка - модель достаточно мала
+    const MeshLodChain* GetLods() const { return accelerators_.lods.get(); }
+    // Пространственный индекс ребер mesh_ (edge_grid.h); nullptr или пустой - без отсечения
+    const EdgeGrid* GetEdgeGrid() const { return accelerators_.edge_grid.get(); }
+    uint64_t GetModelMatrixVersion() const { return matrix_version_; }
+    
+    // Мировые координаты: mesh_ * model_matrix_, кэш до изменения матрицы
+    const Mesh& GetWorldMesh() const;
+    BoundingBox GetWorldBounds() const;
     
     // Настройки отображения
     void SetLineColor(const QColor& color);
@@ -102,12 +344,34 @@ public:
     void SetLineWidth(int width);
 
 private:
-    Mesh mesh_;
-    std::unique_ptr<FileReader> file_reader_;
-    std::unique_ptr<NormalizationService> normalization_service_;
+    MeshHandle mesh_ = std::make_shared<const Mesh>();
+    uint64_t mesh_version_ = 0;
+    MeshAccelerators accelerators_;  // Строятся при загрузке (в потоке загрузки)
+    std::unique_ptr<FileReader> file_reader_;       // Создается в конструкторе
+    // Только для load_task_ (рабочий поток): буферы разбора живут между
+    // фоновыми загрузками. Объявлен до load_task_ - разрушается после него
+    std::unique_ptr<FileReader> async_reader_;
+    std::unique_ptr<MeshLoadTask> load_task_;
+    std::shared_ptr<Scene> scene_;  // Снимки держат свою копию (editScene)
+    std::unique_ptr<GeometryCache> geometry_cache_;  // Создается в конструкторе
+    VertexPrecision vertex_precision_ = VertexPrecision::kFloat;
+    
+    // Накопленная матрица модели
+    TransformMatrix model_matrix_ = TransformMatrixBuilder::CreateIdentityMatrix();
+    uint64_t matrix_version_ = 0;
+    
+    // Кэш мировых координат
+    mutable Mesh world_mesh_;
+    mutable BoundingBox world_bounds_{};
+    mutable uint64_t world_version_ = UINT64_MAX;  // Версия матрицы, по которой построен кэш
     
     // Вспомогательные методы
-    void initializeServices();
+    void initializeServices(); // FileReader'ы и GeometryCache
+    void applyTransform(const TransformMatrix& matrix); // model_matrix_ = matrix * model_matrix_
+    void resetModelMatrix();
+    void updateWorldCache() const;
+    void ensureScene(); // Сцена создается при первом объекте
+    Scene& editScene(); // Копия сцены, если ее держит снимок
 };
 
 // ====== Результат операций Facade ======
@@ -121,6 +385,7 @@ class FacadeOperationResult {
     
     std::string GetErrorMessage() const { return message_; }
     const Mesh& GetMesh() const { return mesh_; }
+    Mesh TakeMesh() { return std::move(mesh_); }  // Забирает Mesh без копирования
 
  private:
      bool success_;
@@ -128,4 +393,6 @@ class FacadeOperationResult {
      Mesh mesh_;
 };
 
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
+
+#endif  // MODEL_H_
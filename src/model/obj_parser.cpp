@@ -0,0 +1,227 @@
+// OBJ_PARSER.CPP - Реализация параллельного парсера OBJ
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - Разбор токенов через std::from_chars (без локали, без аллокаций)
+// - Разбиение буфера на куски, выровненные по концу строки
+// - Разбор строк "v x y z [w]" и "f v1 v2 v3 ..." внутри куска
+// - Слияние кусков с глобальными смещениями индексов (дописывание в результат)
+//
+// ФОРМАТ СТРОК:
+// - Разделители токенов: пробел и табуляция, "\r\n" допускается
+// - "#", "vt", "vn", "o", "g", "s", "usemtl" и прочее пропускаются
+// - "v": первые три токена - координаты, остальные (w, цвет) игнорируются
+// - "f": не меньше трех вершин, из "v/vt/vn" берется только v
+
+#include "obj_parser.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+#include "parallel.h"
+#include "profiler.h"
+
+namespace s21 {
+
+namespace {
+
+inline bool isBlank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+inline const char* skipBlanks(const char* p, const char* end) {
+    while (p < end && isBlank(*p)) ++p;
+    return p;
+}
+
+inline const char* tokenEnd(const char* p, const char* end) {
+    while (p < end && !isBlank(*p)) ++p;
+    return p;
+}
+
+}  // namespace
+
+bool ParseObjDouble(const char* begin, const char* end, double& value) {
+    if (begin < end && *begin == '+') ++begin;  // from_chars не принимает '+'
+    auto [ptr, ec] = std::from_chars(begin, end, value);
+    return ec == std::errc() && ptr == end;
+}
+
+bool ParseObjIndex(const char* begin, const char* end, int& index) {
+    const char* slash = std::find(begin, end, '/');
+    if (begin < slash && *begin == '+') ++begin;
+    auto [ptr, ec] = std::from_chars(begin, slash, index);
+    return ec == std::errc() && ptr == slash;
+}
+
+void ObjParseResult::Clear() {
+    x.clear();
+    y.clear();
+    z.clear();
+    face_indices.clear();
+    face_offsets.clear();
+    has_zero_index = false;
+    success = true;
+    error_line = 0;
+}
+
+bool ObjParser::Parse(const char* data, size_t size, ObjParseResult& result) {
+    splitIntoChunks(data, size);
+    ParallelFor(chunks_.size(), [this](size_t i) {
+        S21_PROFILE_SCOPE("parse: chunk", kLoad);  // В потоке пула
+        parseChunk(chunks_[i]);
+    });
+    S21_PROFILE_SCOPE("parse: merge", kLoad);
+    merge(result);
+    return result.success;
+}
+
+void ObjParser::splitIntoChunks(const char* data, size_t size) {
+    size_t wanted = std::max<size_t>(1, size / kMinChunkSize);
+    size_t count = std::min<size_t>(wanted, size_t(GetWorkerCount()) * 4);
+    count = std::max<size_t>(count, 1);
+
+    chunks_.resize(count);
+    const char* end = data + size;
+    const char* begin = data;
+    for (size_t i = 0; i < count; ++i) {
+        const char* chunkEnd = (i + 1 == count) ? end : data + size / count * (i + 1);
+        if (chunkEnd < begin) chunkEnd = begin;
+        if (chunkEnd < end) {
+            const void* newline = std::memchr(chunkEnd, '\n', end - chunkEnd);
+            chunkEnd = newline ? static_cast<const char*>(newline) + 1 : end;
+        }
+
+        Chunk& chunk = chunks_[i];
+        chunk.begin = begin;
+        chunk.end = chunkEnd;
+        chunk.coords.clear();
+        chunk.face_indices.clear();
+        chunk.face_offsets.clear();
+        chunk.relative_slots.clear();
+        chunk.has_zero_index = false;
+        chunk.error_line = 0;
+        begin = chunkEnd;
+    }
+}
+
+void ObjParser::parseChunk(Chunk& chunk) {
+    // Грубая оценка: ~30 байт на строку "v", чтобы избежать частых реаллокаций
+    // (емкость сохраняется между вызовами, повторный reserve ничего не выделяет)
+    chunk.coords.reserve((chunk.end - chunk.begin) / 30 * 3);
+
+    size_t line = 0;
+    const char* p = chunk.begin;
+    while (p < chunk.end) {
+        ++line;
+        const void* newline = std::memchr(p, '\n', chunk.end - p);
+        const char* eol = newline ? static_cast<const char*>(newline) : chunk.end;
+        if (!parseLine(p, eol, chunk)) {
+            chunk.error_line = line;
+            return;
+        }
+        p = eol + 1;
+    }
+}
+
+bool ObjParser::parseLine(const char* begin, const char* end, Chunk& chunk) {
+    const char* p = skipBlanks(begin, end);
+    if (p == end || *p == '#') return true;
+
+    const char* keywordEnd = tokenEnd(p, end);
+    size_t keywordLength = keywordEnd - p;
+    if (keywordLength != 1 || (*p != 'v' && *p != 'f')) return true;
+
+    if (*p == 'v') {
+        double xyz[3];
+        p = keywordEnd;
+        for (double& value : xyz) {
+            p = skipBlanks(p, end);
+            const char* tokEnd = tokenEnd(p, end);
+            if (p == tokEnd || !ParseObjDouble(p, tokEnd, value)) return false;
+            p = tokEnd;
+        }
+        for (double value : xyz) chunk.coords.push_back(static_cast<float>(value));
+        return true;
+    }
+
+    // "f": индексы пишутся сразу в общий буфер куска
+    size_t first = chunk.face_indices.size();
+    int localVertexCount = static_cast<int>(chunk.coords.size() / 3);
+    p = skipBlanks(keywordEnd, end);
+    while (p < end) {
+        const char* tokEnd = tokenEnd(p, end);
+        int raw = 0;
+        if (!ParseObjIndex(p, tokEnd, raw)) return false;
+        if (raw > 0) {
+            chunk.face_indices.push_back(raw - 1);
+        } else {
+            if (raw == 0) chunk.has_zero_index = true;
+            chunk.relative_slots.push_back(chunk.face_indices.size());
+            chunk.face_indices.push_back(localVertexCount + raw);
+        }
+        p = skipBlanks(tokEnd, end);
+    }
+    if (chunk.face_indices.size() - first < 3) return false;
+    chunk.face_offsets.push_back(first);
+    return true;
+}
+
+void ObjParser::merge(ObjParseResult& result) {
+    // Ошибка формата: берем самую раннюю по буферу
+    for (const Chunk& chunk : chunks_) {
+        if (chunk.error_line == 0) continue;
+        const char* data = chunks_.front().begin;
+        size_t before = std::count(data, chunk.begin, '\n');
+        result.success = false;
+        result.error_line = before + chunk.error_line;
+        return;
+    }
+
+    // Префиксные суммы: смещения каждого куска в итоговых буферах
+    // (после уже накопленных вершин и граней)
+    size_t count = chunks_.size();
+    size_t vertexBase = result.GetVertexCount();
+    size_t firstFace = result.GetFaceCount();
+    vertex_base_.assign(count + 1, vertexBase);
+    index_base_.assign(count + 1, result.face_indices.size());
+    face_base_.assign(count + 1, firstFace);
+    for (size_t i = 0; i < count; ++i) {
+        vertex_base_[i + 1] = vertex_base_[i] + chunks_[i].coords.size() / 3;
+        index_base_[i + 1] = index_base_[i] + chunks_[i].face_indices.size();
+        face_base_[i + 1] = face_base_[i] + chunks_[i].face_offsets.size();
+        result.has_zero_index = result.has_zero_index || chunks_[i].has_zero_index;
+    }
+
+    result.x.resize(vertex_base_[count]);
+    result.y.resize(vertex_base_[count]);
+    result.z.resize(vertex_base_[count]);
+    result.face_indices.resize(index_base_[count]);
+    if (face_base_[count] > firstFace) {
+        result.face_offsets.resize(face_base_[count] + 1);
+        result.face_offsets[face_base_[count]] = index_base_[count];
+    }
+
+    ParallelFor(count, [&](size_t i) {
+        const Chunk& chunk = chunks_[i];
+        size_t vertices = chunk.coords.size() / 3;
+        float* x = result.x.data() + vertex_base_[i];
+        float* y = result.y.data() + vertex_base_[i];
+        float* z = result.z.data() + vertex_base_[i];
+        for (size_t v = 0; v < vertices; ++v) {
+            x[v] = chunk.coords[v * 3];
+            y[v] = chunk.coords[v * 3 + 1];
+            z[v] = chunk.coords[v * 3 + 2];
+        }
+
+        int* indices = result.face_indices.data() + index_base_[i];
+        std::copy(chunk.face_indices.begin(), chunk.face_indices.end(), indices);
+        int chunkBase = static_cast<int>(vertex_base_[i]);
+        for (size_t slot : chunk.relative_slots) indices[slot] += chunkBase;
+
+        size_t* offsets = result.face_offsets.data() + face_base_[i];
+        for (size_t f = 0; f < chunk.face_offsets.size(); ++f) {
+            offsets[f] = chunk.face_offsets[f] + index_base_[i];
+        }
+    });
+}
+
+}  // namespace s21
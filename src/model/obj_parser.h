@@ -0,0 +1,103 @@
+// OBJ_PARSER.H - Параллельный парсер OBJ из памяти
+//
+// ЗАЧЕМ НУЖЕН:
+// Построчный разбор через std::getline + splitString выделяет память на каждую
+// строку и каждый токен, и работает в одном потоке. Для сканов на десятки
+// миллионов вершин это минуты загрузки. ObjParser разбирает уже отображенный
+// в память файл (MappedFile) по кускам на всех ядрах без аллокаций на строку.
+//
+// ЧТО СОДЕРЖИТ:
+// - ParseObjDouble / ParseObjIndex - разбор одного токена через std::from_chars
+//   (общие для построчного и параллельного режимов FileReader)
+// - ObjParseResult - результат: координаты массивами x, y, z (как в Mesh)
+//   и грани в CSR виде; накапливается между вызовами Parse
+// - ObjParser - разбиение буфера на куски по границам строк, разбор, слияние
+//
+// КАК РАБОТАЕТ:
+// 1. Буфер делится на куски ~kMinChunkSize, граница сдвигается за ближайший '\n'
+// 2. Каждый кусок разбирается независимо (ParallelFor): строки "v" и "f"
+// 3. Положительные индексы граней сразу глобальные (1-based -> 0-based),
+//    отрицательные (относительные) считаются от начала куска и запоминаются
+// 4. Слияние: префиксные суммы по кускам, копирование на свои места,
+//    к относительным индексам добавляется число вершин в предыдущих кусках
+// 5. Ошибка формата -> номер строки считается по числу '\n' до куска
+// 6. Буфер может быть частью файла (прогрессивная загрузка): результат
+//    дописывается в конец ObjParseResult, относительные индексы считаются
+//    от уже накопленного числа вершин
+// 7. Буферы кусков и результата сохраняют память между вызовами
+//    (ObjParseResult::Clear не освобождает емкость)
+//
+// Все в namespace s21
+
+#ifndef OBJ_PARSER_H_
+#define OBJ_PARSER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace s21 {
+
+// Разбор токена целиком как double ("1.5", "-2e3", "+4"). false если мусор.
+bool ParseObjDouble(const char* begin, const char* end, double& value);
+
+// Разбор индекса вершины из токена грани ("7", "7/1", "7//3", "-2/1/1").
+// Возвращает сырое значение из файла (1-based или отрицательное).
+bool ParseObjIndex(const char* begin, const char* end, int& index);
+
+// ====== Результат разбора ======
+struct ObjParseResult {
+    std::vector<float> x, y, z;          // Координаты вершин (float, как в Mesh)
+    std::vector<int> face_indices;       // 0-based индексы вершин всех граней подряд
+    std::vector<size_t> face_offsets;    // Грань i = [face_offsets[i], face_offsets[i + 1])
+    bool has_zero_index = false;         // Встречен индекс 0 (недопустим в OBJ)
+
+    bool success = true;
+    size_t error_line = 0;               // 1-based строка в последнем буфере с ошибкой формата
+
+    size_t GetVertexCount() const { return x.size(); }
+    size_t GetFaceCount() const { return face_offsets.empty() ? 0 : face_offsets.size() - 1; }
+
+    // Грань в конец CSR (индексы уже дописаны в face_indices)
+    void EndFace() {
+        if (face_offsets.empty()) face_offsets.push_back(0);
+        face_offsets.push_back(face_indices.size());
+    }
+
+    // Сброс без освобождения памяти (буферы переиспользуются между загрузками)
+    void Clear();
+};
+
+// ====== Параллельный парсер ======
+class ObjParser {
+public:
+    static constexpr size_t kMinChunkSize = 4u << 20;  // 4 МБ на кусок
+
+    // Разбирает весь буфер [data, data + size) и дописывает вершины и грани
+    // в result; false (и result.error_line) при ошибке формата
+    bool Parse(const char* data, size_t size, ObjParseResult& result);
+
+private:
+    struct Chunk {
+        const char* begin = nullptr;
+        const char* end = nullptr;
+        std::vector<float> coords;            // x0 y0 z0 x1 y1 z1 ...
+        std::vector<int> face_indices;
+        std::vector<size_t> face_offsets;     // Локальные начала граней в face_indices
+        std::vector<size_t> relative_slots;   // Позиции индексов, заданных отрицательными
+        bool has_zero_index = false;
+        size_t error_line = 0;                // 1-based строка внутри куска, 0 = нет ошибки
+    };
+
+    std::vector<Chunk> chunks_;  // Переиспользуется между вызовами Parse
+    std::vector<size_t> vertex_base_, index_base_, face_base_;  // Префиксные суммы merge()
+
+    void splitIntoChunks(const char* data, size_t size);
+    static void parseChunk(Chunk& chunk);
+    static bool parseLine(const char* begin, const char* end, Chunk& chunk);
+    void merge(ObjParseResult& result);
+};
+
+}  // namespace s21
+
+#endif  // OBJ_PARSER_H_
@@ -0,0 +1,123 @@
+// PARALLEL.CPP - Реализация примитивов параллельной обработки
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - GetWorkerCount(): std::thread::hardware_concurrency() с запасным значением 1
+// - ThreadPool: постоянные потоки, задание раздается через generation_
+//   (каждый рабочий поток видит каждое задание ровно один раз)
+// - ParallelFor(): динамическая раздача задач через std::atomic счетчик
+// - ThreadPool::Current(): thread_local указатель на пул потока
+//
+// Для одной задачи, одного ядра или занятого пула потоки не будятся вовсе.
+
+#include "parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace s21 {
+
+unsigned GetWorkerCount() {
+    unsigned count = std::thread::hardware_concurrency();
+    return count == 0 ? 1 : count;
+}
+
+namespace {
+
+thread_local bool t_inPoolTask = false;          // Поток сейчас выполняет задачу пула
+thread_local ThreadPool* t_currentPool = nullptr;  // SetCurrent(); nullptr - Shared()
+
+}  // namespace
+
+ThreadPool::ThreadPool(unsigned threadCount) {
+    unsigned workers = threadCount > 1 ? threadCount - 1 : 0;
+    workers_.reserve(workers);
+    for (unsigned i = 0; i < workers; ++i) workers_.emplace_back(&ThreadPool::workerLoop, this);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) worker.join();
+}
+
+ThreadPool& ThreadPool::Shared() {
+    static ThreadPool pool;
+    return pool;
+}
+
+ThreadPool& ThreadPool::Current() {
+    return t_currentPool ? *t_currentPool : Shared();
+}
+
+void ThreadPool::SetCurrent(ThreadPool* pool) {
+    t_currentPool = pool;
+}
+
+void ThreadPool::ParallelFor(size_t taskCount, const std::function<void(size_t)>& task) {
+    size_t threadCount = std::min<size_t>(taskCount, GetThreadCount());
+    if (threadCount <= 1 || t_inPoolTask) {
+        for (size_t i = 0; i < taskCount; ++i) task(i);
+        return;
+    }
+
+    // Пул занят другим потоком: ждать его задания (загрузка может идти
+    // секунды) или создавать потоки на каждый вызов хуже, чем выполнить
+    // задание здесь
+    std::unique_lock<std::mutex> call(call_mutex_, std::try_to_lock);
+    if (!call.owns_lock()) {
+        for (size_t i = 0; i < taskCount; ++i) task(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        task_count_ = taskCount;
+        next_.store(0, std::memory_order_relaxed);
+        active_ = workers_.size();
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    runTasks();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this]() { return active_ == 0; });
+    task_ = nullptr;
+}
+
+void ThreadPool::workerLoop() {
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&]() { return stop_ || generation_ != seen; });
+            if (stop_) return;
+            seen = generation_;
+        }
+        runTasks();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--active_ == 0) done_.notify_one();
+        }
+    }
+}
+
+void ThreadPool::runTasks() {
+    t_inPoolTask = true;
+    for (size_t i = next_.fetch_add(1); i < task_count_; i = next_.fetch_add(1)) {
+        (*task_)(i);
+    }
+    t_inPoolTask = false;
+}
+
+void ParallelFor(size_t taskCount, const std::function<void(size_t)>& task) {
+    ThreadPool::Current().ParallelFor(taskCount, task);
+}
+
+}  // namespace s21
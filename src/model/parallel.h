@@ -0,0 +1,94 @@
+// PARALLEL.H - Простые примитивы параллельной обработки
+//
+// ЗАЧЕМ НУЖЕН:
+// Большие модели (миллионы вершин) обрабатываются кусками на всех ядрах.
+// Вместо того чтобы каждый модуль сам создавал потоки, используется
+// общий помощник ParallelFor.
+//
+// ЧТО СОДЕРЖИТ:
+// - GetWorkerCount() - количество рабочих потоков (по числу ядер)
+// - ThreadPool - постоянные рабочие потоки (создаются один раз, не на каждый вызов)
+// - ParallelFor() - выполняет taskCount независимых задач на пуле потока
+//   (ThreadPool::Current(): свой пул потока или общий ThreadPool::Shared())
+// - AbandonCheck - проверка отмены долгой работы между задачами
+//
+// КАК РАБОТАЕТ:
+// 1. ThreadPool::Shared() - общий пул на GetWorkerCount() потоков (включая вызывающий)
+// 2. Потоки пула ждут задание на condition_variable, номера задач
+//    разбираются через атомарный счетчик
+// 3. Вызывающий поток тоже выполняет задачи и ждет завершения остальных
+// 4. Пул выполняет одно задание за раз: если он занят другим потоком,
+//    задание выполняется последовательно в вызывающем потоке (потоки на
+//    вызов не создаются); вложенный вызов из задачи пула - тоже
+//    последовательно в том же потоке
+// 5. Поток, которому нельзя ждать чужих заданий (отрисовка во время фоновой
+//    загрузки), получает свой пул: SetCurrent() направляет в него
+//    ParallelFor() этого потока (RenderPipeline)
+//
+// Все в namespace s21
+
+#ifndef PARALLEL_H_
+#define PARALLEL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace s21 {
+
+// Количество рабочих потоков (не меньше 1)
+unsigned GetWorkerCount();
+
+class ThreadPool {
+public:
+    // threadCount - всего потоков вместе с вызывающим (1 - без рабочих потоков)
+    explicit ThreadPool(unsigned threadCount = GetWorkerCount());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned GetThreadCount() const { return static_cast<unsigned>(workers_.size()) + 1; }
+
+    // Выполняет task(i) для i в [0, taskCount). Порядок выполнения не определен.
+    void ParallelFor(size_t taskCount, const std::function<void(size_t)>& task);
+
+    static ThreadPool& Shared();
+    // Пул для ParallelFor() в вызывающем потоке; по умолчанию - Shared()
+    static ThreadPool& Current();
+    // nullptr - снова Shared(). Пул должен жить, пока поток им пользуется
+    static void SetCurrent(ThreadPool* pool);
+
+private:
+    std::vector<std::thread> workers_;
+    std::mutex call_mutex_;                  // Одно задание за раз
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    uint64_t generation_ = 0;                // Номер текущего задания
+    size_t active_ = 0;                      // Рабочие потоки, не закончившие задание
+    bool stop_ = false;
+
+    const std::function<void(size_t)>* task_ = nullptr;
+    size_t task_count_ = 0;
+    std::atomic<size_t> next_{0};
+
+    void workerLoop();
+    void runTasks();
+};
+
+// Выполняет task(i) для i в [0, taskCount) на ThreadPool::Current()
+void ParallelFor(size_t taskCount, const std::function<void(size_t)>& task);
+
+// true - бросить работу (например, кадр устарел). Вызывается из задач пула,
+// поэтому должна быть потокобезопасной
+using AbandonCheck = std::function<bool()>;
+
+}  // namespace s21
+
+#endif  // PARALLEL_H_
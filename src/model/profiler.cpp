@@ -0,0 +1,122 @@
+// PROFILER.CPP - Реализация кольцевого буфера замеров
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - Часы (steady_clock от первого обращения) и номера потоков
+// - Record(): запись в ячейку под номером последовательности (seqlock)
+// - Snapshot(): согласованная копия готовых ячеек
+// - WriteChromeTrace(): события "X" (полные) формата Chrome Trace Event
+
+#include "profiler.h"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+
+namespace s21 {
+
+namespace {
+
+const std::chrono::steady_clock::time_point& epoch() {
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    return start;
+}
+
+std::atomic<uint32_t> g_next_thread{0};
+
+// Имена - литералы из кода, но кавычки и обратная косая черта экранируются
+void writeJsonString(std::FILE* out, const char* text) {
+    std::fputc('"', out);
+    for (const char* p = text ? text : ""; *p; ++p) {
+        if (*p == '"' || *p == '\\') std::fputc('\\', out);
+        std::fputc(*p, out);
+    }
+    std::fputc('"', out);
+}
+
+}  // namespace
+
+const char* GetProfileCategoryName(ProfileCategory category) {
+    switch (category) {
+        case ProfileCategory::kLoad: return "load";
+        case ProfileCategory::kTransform: return "transform";
+        case ProfileCategory::kFrame: return "frame";
+    }
+    return "unknown";
+}
+
+Profiler& Profiler::Instance() {
+    static Profiler profiler;
+    return profiler;
+}
+
+uint64_t Profiler::NowNs() {
+    const auto& start = epoch();
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+uint32_t Profiler::CurrentThread() {
+    thread_local const uint32_t id = g_next_thread.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+void Profiler::Record(const char* name, ProfileCategory category, uint64_t startNs, uint64_t durationNs) {
+    if (!IsEnabled()) return;
+    uint64_t ticket = head_.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = slots_[ticket & (kCapacity - 1)];
+    slot.sequence.store(2 * ticket + 1, std::memory_order_relaxed);  // Запись идет
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.start_ns.store(startNs, std::memory_order_relaxed);
+    slot.duration_ns.store(durationNs, std::memory_order_relaxed);
+    slot.thread.store(CurrentThread(), std::memory_order_relaxed);
+    slot.category.store(static_cast<uint8_t>(category), std::memory_order_relaxed);
+    slot.sequence.store(2 * ticket + 2, std::memory_order_release);
+}
+
+std::vector<ProfileEvent> Profiler::Snapshot() const {
+    uint64_t head = head_.load(std::memory_order_acquire);
+    uint64_t first = head > kCapacity ? head - kCapacity : 0;
+    std::vector<ProfileEvent> events;
+    events.reserve(size_t(head - first));
+    for (uint64_t ticket = first; ticket < head; ++ticket) {
+        const Slot& slot = slots_[ticket & (kCapacity - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != 2 * ticket + 2) continue;  // Не готова/перезаписана
+        ProfileEvent event;
+        event.name = slot.name.load(std::memory_order_relaxed);
+        event.start_ns = slot.start_ns.load(std::memory_order_relaxed);
+        event.duration_ns = slot.duration_ns.load(std::memory_order_relaxed);
+        event.thread = slot.thread.load(std::memory_order_relaxed);
+        event.category = static_cast<ProfileCategory>(slot.category.load(std::memory_order_relaxed));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != 2 * ticket + 2) continue;
+        events.push_back(event);
+    }
+    return events;
+}
+
+void Profiler::Clear() {
+    // Старые ячейки остаются, но их номера последовательности уже не совпадут
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    head_.store(head + kCapacity, std::memory_order_release);
+}
+
+bool Profiler::WriteChromeTrace(const std::string& path) const {
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> file(std::fopen(path.c_str(), "w"), &std::fclose);
+    if (!file) return false;
+    std::FILE* out = file.get();
+    std::vector<ProfileEvent> events = Snapshot();
+    std::fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (size_t i = 0; i < events.size(); ++i) {
+        const ProfileEvent& event = events[i];
+        std::fprintf(out, "{\"name\":");
+        writeJsonString(out, event.name);
+        std::fprintf(out, ",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}%s\n",
+                     GetProfileCategoryName(event.category), event.thread, event.start_ns / 1e3,
+                     event.duration_ns / 1e3, i + 1 < events.size() ? "," : "");
+    }
+    std::fprintf(out, "]}\n");
+    return std::fclose(file.release()) == 0;
+}
+
+}  // namespace s21
@@ -0,0 +1,179 @@
+// PROFILER.H - Легкие замеры горячих участков (загрузка, трансформация, кадр)
+//
+// ЗАЧЕМ НУЖЕН:
+// На жалобу "просмотрщик тормозит" нужно видеть, на что ушло время:
+// какая фаза загрузки, какой этап кадра. Замеры пишутся в кольцевой буфер
+// без блокировок и показываются в ModelWidget (ProfilerOverlay) или
+// сохраняются в JSON формата Chrome Trace (chrome://tracing, Perfetto).
+//
+// ЧТО СОДЕРЖИТ:
+// - S21_PROFILING - 1: замеры собираются, 0: весь код замеров исчезает
+// - ProfileCategory - загрузка, трансформация модели, кадр
+// - ProfileEvent - один замер (имя, начало, длительность, поток)
+// - Profiler класс - общий кольцевой буфер, снимок, экспорт Chrome Trace
+// - ProfileScope - замер области видимости (S21_PROFILE_SCOPE)
+// - ProfileAccumulator - сумма многих коротких участков одним событием
+//
+// КАК РАБОТАЕТ:
+// 1. По умолчанию S21_PROFILING = 1 в отладочной сборке и 0 с NDEBUG;
+//    -DS21_PROFILING=1 (make PROFILE=1, cmake -DS21_PROFILING=ON)
+//    включает замеры в оптимизированной сборке. При 0 ProfileScope и
+//    ProfileAccumulator - пустые inline классы, вызовов часов нет
+// 2. Record(): номер записи - fetch_add общего счетчика, запись в ячейку
+//    номер & (kCapacity - 1). Ячейка защищена номером последовательности
+//    (seqlock): нечетный - идет запись. Писатели не ждут друг друга и
+//    читателя, старые записи перезаписываются
+// 3. Snapshot(): копирует последние kCapacity записей; ячейки, которые
+//    переписывались во время чтения, пропускаются
+// 4. Имена и категории - строковые литералы (хранится только указатель)
+// 5. Время - steady_clock в наносекундах от первого обращения к Profiler
+//
+// Без зависимостей от Qt. Все в namespace s21
+
+#ifndef PROFILER_H_
+#define PROFILER_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifndef S21_PROFILING
+#ifdef NDEBUG
+#define S21_PROFILING 0
+#else
+#define S21_PROFILING 1
+#endif
+#endif
+
+namespace s21 {
+
+enum class ProfileCategory : uint8_t {
+    kLoad,       // Фазы FileReader::ReadMesh
+    kTransform,  // Матрица модели, мировые координаты
+    kFrame       // Кадр и этапы отрисовки
+};
+
+const char* GetProfileCategoryName(ProfileCategory category);  // "load", "transform", "frame"
+
+struct ProfileEvent {
+    const char* name = nullptr;
+    ProfileCategory category = ProfileCategory::kFrame;
+    uint32_t thread = 0;       // Номер потока в порядке первого замера
+    uint64_t start_ns = 0;
+    uint64_t duration_ns = 0;
+};
+
+class Profiler {
+public:
+    static constexpr size_t kCapacity = 1u << 14;  // Степень двойки
+
+    static Profiler& Instance();
+    static uint64_t NowNs();
+    static uint32_t CurrentThread();
+
+    // Выключенный профилировщик не пишет замеры (проверка - одно атомарное чтение)
+    void SetEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+    bool IsEnabled() const { return S21_PROFILING && enabled_.load(std::memory_order_relaxed); }
+
+    void Record(const char* name, ProfileCategory category, uint64_t startNs, uint64_t durationNs);
+    std::vector<ProfileEvent> Snapshot() const;  // По времени записи, старые первыми
+    void Clear();
+
+    // false - файл не удалось записать
+    bool WriteChromeTrace(const std::string& path) const;
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> sequence{0};  // 2 * номер + 2 - запись готова
+        std::atomic<const char*> name{nullptr};
+        std::atomic<uint64_t> start_ns{0};
+        std::atomic<uint64_t> duration_ns{0};
+        std::atomic<uint32_t> thread{0};
+        std::atomic<uint8_t> category{0};
+    };
+
+    std::array<Slot, kCapacity> slots_;
+    std::atomic<uint64_t> head_{0};  // Номер следующей записи
+    std::atomic<bool> enabled_{true};
+
+    Profiler() = default;
+};
+
+#if S21_PROFILING
+
+class ProfileScope {
+public:
+    ProfileScope(const char* name, ProfileCategory category)
+        : name_(name), category_(category), start_(Profiler::NowNs()) {}
+    ~ProfileScope() {
+        Profiler::Instance().Record(name_, category_, start_, Profiler::NowNs() - start_);
+    }
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* name_;
+    ProfileCategory category_;
+    uint64_t start_;
+};
+
+// Много коротких участков (строки файла) - одно событие с суммарной длительностью,
+// начало - первый участок
+class ProfileAccumulator {
+public:
+    ProfileAccumulator(const char* name, ProfileCategory category) : name_(name), category_(category) {}
+    ~ProfileAccumulator() {
+        if (started_) Profiler::Instance().Record(name_, category_, first_, total_);
+    }
+    ProfileAccumulator(const ProfileAccumulator&) = delete;
+    ProfileAccumulator& operator=(const ProfileAccumulator&) = delete;
+
+    void Begin() {
+        begin_ = Profiler::NowNs();
+        if (!started_) first_ = begin_;
+        started_ = true;
+    }
+    void End() { total_ += Profiler::NowNs() - begin_; }
+
+private:
+    const char* name_;
+    ProfileCategory category_;
+    uint64_t first_ = 0;
+    uint64_t begin_ = 0;
+    uint64_t total_ = 0;
+    bool started_ = false;
+};
+
+#else
+
+class ProfileScope {
+public:
+    ProfileScope(const char*, ProfileCategory) {}
+};
+
+class ProfileAccumulator {
+public:
+    ProfileAccumulator(const char*, ProfileCategory) {}
+    void Begin() {}
+    void End() {}
+};
+
+#endif
+
+#define S21_PROFILE_CONCAT_IMPL(a, b) a##b
+#define S21_PROFILE_CONCAT(a, b) S21_PROFILE_CONCAT_IMPL(a, b)
+
+// S21_PROFILE_SCOPE("read: edges", kLoad) - замер до конца блока
+#if S21_PROFILING
+#define S21_PROFILE_SCOPE(name, category) \
+    ::s21::ProfileScope S21_PROFILE_CONCAT(s21_profile_scope_, __LINE__)(name, ::s21::ProfileCategory::category)
+#else
+#define S21_PROFILE_SCOPE(name, category) static_cast<void>(0)
+#endif
+
+}  // namespace s21
+
+#endif  // PROFILER_H_
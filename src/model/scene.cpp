@@ -0,0 +1,164 @@
+// SCENE.CPP - Реализация сцены и кэша геометрии
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - Ключ геометрии: абсолютный путь + размер + mtime файла
+// - Acquire(): попадание по живому weak_ptr, иначе загрузка и MeshAccelerators
+// - Список объектов сцены с идентификаторами и версией
+// - Границы сцены по углам локальных границ геометрии
+
+#include "scene.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <limits>
+#include <unordered_set>
+
+#include "io.h"           // FileReader, NormalizationParameters
+#include "mesh_loader.h"  // BuildMeshAccelerators
+
+namespace s21 {
+
+namespace {
+
+namespace fs = std::filesystem;
+
+struct FileStamp {
+    std::string path;
+    uint64_t size = 0;
+    int64_t mtime = 0;
+};
+
+// Ошибка - геометрия загружается без кэша, текст ошибки дает FileReader
+bool readFileStamp(const std::string& path, FileStamp& stamp) {
+    std::error_code ec;
+    fs::path absolute = fs::absolute(path, ec);
+    if (ec) return false;
+    stamp.path = absolute.lexically_normal().string();
+    stamp.size = fs::file_size(absolute, ec);
+    if (ec) return false;
+    stamp.mtime = static_cast<int64_t>(fs::last_write_time(absolute, ec).time_since_epoch().count());
+    return !ec;
+}
+
+}  // namespace
+
+// ====== GeometryCache ======
+
+FacadeOperationResult GeometryCache::Acquire(const std::string& path, FileReader& reader,
+                                             GeometryHandle& out) {
+    FileStamp stamp;
+    bool keyed = readFileStamp(path, stamp);
+    if (keyed) {
+        auto found = entries_.find(stamp.path);
+        if (found != entries_.end() && found->second.size == stamp.size &&
+            found->second.mtime == stamp.mtime) {
+            if (GeometryHandle geometry = found->second.geometry.lock()) {
+                ++hits_;
+                out = std::move(geometry);
+                return FacadeOperationResult(true, "Geometry reused");
+            }
+        }
+    }
+
+    ++misses_;
+    FacadeOperationResult result = reader.ReadMesh(path, NormalizationParameters());
+    if (result.IsError()) return result;
+
+    auto geometry = std::make_shared<SceneGeometry>();
+    geometry->path = keyed ? stamp.path : path;
+    geometry->mesh = result.TakeMesh();
+    geometry->bounds = geometry->mesh.ComputeBounds();
+    BuildMeshAccelerators(geometry->mesh, geometry->accelerators);
+
+    prune();
+    if (keyed) entries_[stamp.path] = Entry{geometry, stamp.size, stamp.mtime};
+    out = std::move(geometry);
+    return FacadeOperationResult(true, result.GetErrorMessage());
+}
+
+size_t GeometryCache::GetLiveCount() const {
+    return static_cast<size_t>(std::count_if(entries_.begin(), entries_.end(), [](const auto& entry) {
+        return !entry.second.geometry.expired();
+    }));
+}
+
+void GeometryCache::prune() {
+    std::erase_if(entries_, [](const auto& entry) { return entry.second.geometry.expired(); });
+}
+
+// ====== Scene ======
+
+ObjectId Scene::AddObject(GeometryHandle geometry, const TransformMatrix& transform) {
+    ObjectId id = next_id_++;
+    objects_.push_back(SceneObject{id, std::move(geometry), transform});
+    ++version_;
+    return id;
+}
+
+bool Scene::RemoveObject(ObjectId id) {
+    auto found = std::find_if(objects_.begin(), objects_.end(),
+                              [id](const SceneObject& object) { return object.id == id; });
+    if (found == objects_.end()) return false;
+    objects_.erase(found);
+    ++version_;
+    return true;
+}
+
+void Scene::Clear() {
+    objects_.clear();
+    ++version_;
+}
+
+bool Scene::TransformObject(ObjectId id, const TransformMatrix& step) {
+    SceneObject* object = findObject(id);
+    if (!object) return false;
+    object->transform = step.Multiply(object->transform);
+    ++version_;
+    return true;
+}
+
+bool Scene::SetObjectTransform(ObjectId id, const TransformMatrix& transform) {
+    SceneObject* object = findObject(id);
+    if (!object) return false;
+    object->transform = transform;
+    ++version_;
+    return true;
+}
+
+const SceneObject* Scene::FindObject(ObjectId id) const {
+    return const_cast<Scene*>(this)->findObject(id);
+}
+
+SceneObject* Scene::findObject(ObjectId id) {
+    // Идентификаторы растут в порядке добавления, удаление порядок не меняет
+    auto found = std::lower_bound(objects_.begin(), objects_.end(), id,
+                                  [](const SceneObject& object, ObjectId value) { return object.id < value; });
+    return found != objects_.end() && found->id == id ? &*found : nullptr;
+}
+
+size_t Scene::GetGeometryCount() const {
+    std::unordered_set<const SceneGeometry*> unique;
+    for (const SceneObject& object : objects_) unique.insert(object.geometry.get());
+    return unique.size();
+}
+
+BoundingBox Scene::ComputeBounds() const {
+    if (objects_.empty()) return BoundingBox{};
+    constexpr double kMax = std::numeric_limits<double>::max();
+    BoundingBox result{{kMax, kMax, kMax}, {-kMax, -kMax, -kMax}};
+    for (const SceneObject& object : objects_) {
+        const BoundingBox& local = object.geometry->bounds;
+        for (int corner = 0; corner < 8; ++corner) {
+            Point3D point{corner & 1 ? local.max.x : local.min.x, corner & 2 ? local.max.y : local.min.y,
+                          corner & 4 ? local.max.z : local.min.z};
+            object.transform.ApplyToPoint(point);
+            result.min = {std::min(result.min.x, point.x), std::min(result.min.y, point.y),
+                          std::min(result.min.z, point.z)};
+            result.max = {std::max(result.max.x, point.x), std::max(result.max.y, point.y),
+                          std::max(result.max.z, point.z)};
+        }
+    }
+    return result;
+}
+
+}  // namespace s21
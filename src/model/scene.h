@@ -0,0 +1,119 @@
+// SCENE.H - Сцена из многих объектов с общей геометрией (instancing)
+//
+// ЗАЧЕМ НУЖЕН:
+// Сборки содержат одну и ту же деталь сотни раз. Хранить Mesh на каждое
+// вхождение - сотни копий координат и ребер. Сцена хранит объекты
+// (SceneObject) - ссылку на общую неизменяемую геометрию и матрицу объекта.
+// Память сборки из 500 вхождений одной детали - одна копия геометрии
+// и 500 матриц. Повторная загрузка того же файла берет геометрию из
+// GeometryCache без разбора.
+//
+// ЧТО СОДЕРЖИТ:
+// - SceneGeometry - Mesh, его ускоряющие структуры и локальные границы
+// - GeometryCache класс - уже загруженная геометрия по пути к файлу
+// - SceneObject - геометрия + матрица объекта
+// - Scene класс - список объектов, добавление/удаление/трансформация
+//
+// КАК РАБОТАЕТ:
+// 1. GeometryCache::Acquire(): ключ - абсолютный путь, размер и mtime файла;
+//    пока геометрия используется хотя бы одним объектом, тот же файл
+//    возвращает тот же указатель (попадание), иначе FileReader + построение
+//    MeshAccelerators (промах). Кэш держит только weak_ptr: геометрия
+//    освобождается вместе с последним объектом
+// 2. Геометрия после создания не меняется (shared_ptr<const>), поэтому
+//    ее безопасно разделять между объектами и потоками отрисовки
+// 3. Матрица объекта: локальные координаты геометрии -> координаты сцены;
+//    TransformObject() применяет шаг после накопленной матрицы (как
+//    матрица модели в Model)
+// 4. Отрисовка проходит по GetObjects(): одна MVP на объект, вершины
+//    общей геометрии не копируются
+// 5. ComputeBounds(): углы локальных границ геометрии через матрицу
+//    объекта - без прохода по вершинам
+//
+// Все в namespace s21
+
+#ifndef SCENE_H_
+#define SCENE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "model.h"  // Mesh, MeshAccelerators, ObjectId, TransformMatrix, FacadeOperationResult
+
+namespace s21 {
+
+class FileReader;
+
+struct SceneGeometry {
+    std::string path;              // Исходный файл (абсолютный)
+    Mesh mesh;                     // Локальные (нормализованные) координаты
+    MeshAccelerators accelerators;
+    BoundingBox bounds{};          // Границы mesh в локальных координатах
+};
+
+using GeometryHandle = std::shared_ptr<const SceneGeometry>;
+
+class GeometryCache {
+public:
+    // Геометрия файла: из кэша или через reader (с построением MeshAccelerators)
+    FacadeOperationResult Acquire(const std::string& path, FileReader& reader, GeometryHandle& out);
+
+    size_t GetHitCount() const { return hits_; }
+    size_t GetMissCount() const { return misses_; }
+    size_t GetLiveCount() const;  // Геометрии, которые еще используются
+
+private:
+    struct Entry {
+        std::weak_ptr<const SceneGeometry> geometry;
+        uint64_t size = 0;
+        int64_t mtime = 0;
+    };
+    std::unordered_map<std::string, Entry> entries_;
+    size_t hits_ = 0;
+    size_t misses_ = 0;
+
+    void prune();  // Удаляет записи освобожденной геометрии
+};
+
+struct SceneObject {
+    ObjectId id;
+    GeometryHandle geometry;
+    TransformMatrix transform;  // Локальные координаты геометрии -> сцена
+};
+
+class Scene {
+public:
+    ObjectId AddObject(GeometryHandle geometry, const TransformMatrix& transform = TransformMatrix());
+    bool RemoveObject(ObjectId id);
+    void Clear();
+
+    // step применяется после накопленной матрицы объекта
+    bool TransformObject(ObjectId id, const TransformMatrix& step);
+    bool SetObjectTransform(ObjectId id, const TransformMatrix& transform);
+    const SceneObject* FindObject(ObjectId id) const;
+
+    bool IsEmpty() const { return objects_.empty(); }
+    size_t GetObjectCount() const { return objects_.size(); }
+    size_t GetGeometryCount() const;  // Разные геометрии среди объектов
+    std::span<const SceneObject> GetObjects() const { return objects_; }
+
+    // Меняется при любом изменении состава или матриц (ключ для кэшей View)
+    uint64_t GetVersion() const { return version_; }
+    BoundingBox ComputeBounds() const;  // Пустая сцена - нулевые границы
+
+private:
+    std::vector<SceneObject> objects_;  // Порядок добавления
+    ObjectId next_id_ = 0;
+    uint64_t version_ = 0;
+
+    SceneObject* findObject(ObjectId id);
+};
+
+}  // namespace s21
+
+#endif  // SCENE_H_
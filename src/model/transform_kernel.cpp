@@ -0,0 +1,346 @@
+// TRANSFORM_KERNEL.CPP - Реализация ядер аффинной трансформации
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - transformScalar: эталонное ядро (и хвосты SIMD ядер)
+// - projectScalar / projectSse2 / projectAvx2: 4 строки матрицы, результат
+//   в отдельные массивы (тот же порядок операций, что у трансформации)
+// - boundsScalar: эталонная редукция min/max (и хвосты SIMD ядер)
+// - transformSse2 / transformAvx2, boundsSse2 / boundsAvx2: x86 ядра через intrinsics, собираются
+//   с __attribute__((target)) и вызываются только если CPU их поддерживает
+// - Диспетчеризацию по __builtin_cpu_supports (GCC/Clang на x86)
+// - Разбиение больших массивов на блоки для ParallelFor
+//   (границы: частичные min/max блоков сводятся после ParallelFor)
+//
+// На других архитектурах (ARM и т.д.) используется скалярное ядро,
+// которое компилятор векторизует сам.
+
+#include "transform_kernel.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "parallel.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define S21_KERNEL_X86 1
+#include <immintrin.h>
+#else
+#define S21_KERNEL_X86 0
+#endif
+
+namespace s21 {
+
+namespace {
+
+constexpr size_t kParallelBlock = 1u << 16;  // Вершин в одной параллельной задаче
+
+void transformScalar(const float* m, float* x, float* y, float* z, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        float px = x[i], py = y[i], pz = z[i];
+        x[i] = ((m[0] * px + m[1] * py) + m[2] * pz) + m[3];
+        y[i] = ((m[4] * px + m[5] * py) + m[6] * pz) + m[7];
+        z[i] = ((m[8] * px + m[9] * py) + m[10] * pz) + m[11];
+    }
+}
+
+void projectScalar(const float* m, const float* x, const float* y, const float* z,
+                   float* const out[4], size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        float px = x[i], py = y[i], pz = z[i];
+        for (int row = 0; row < 4; ++row) {
+            const float* r = m + row * 4;
+            out[row][i] = ((r[0] * px + r[1] * py) + r[2] * pz) + r[3];
+        }
+    }
+}
+
+// v < lo ? v : lo - та же семантика, что у minps(v, lo) / maxps(v, hi)
+void boundsScalar(const float* p, size_t begin, size_t end, float& lo, float& hi) {
+    for (size_t i = begin; i < end; ++i) {
+        float v = p[i];
+        lo = v < lo ? v : lo;
+        hi = v > hi ? v : hi;
+    }
+}
+
+using BoundsAxisFn = void (*)(const float* p, size_t count, float& lo, float& hi);
+
+void boundsAxisScalar(const float* p, size_t count, float& lo, float& hi) {
+    boundsScalar(p, 0, count, lo, hi);
+}
+
+// Одна ось за раз: каждый массив читается один раз, последовательно
+void boundsWith(BoundsAxisFn axis, const float* x, const float* y, const float* z, size_t count,
+                float min[3], float max[3]) {
+    const float* axes[3] = {x, y, z};
+    for (int a = 0; a < 3; ++a) axis(axes[a], count, min[a], max[a]);
+}
+
+#if S21_KERNEL_X86
+
+__attribute__((target("sse2")))
+void transformSse2(const float* m, float* x, float* y, float* z, size_t count) {
+    __m128 r[12];
+    for (int k = 0; k < 12; ++k) r[k] = _mm_set1_ps(m[k]);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 px = _mm_loadu_ps(x + i);
+        __m128 py = _mm_loadu_ps(y + i);
+        __m128 pz = _mm_loadu_ps(z + i);
+        __m128 nx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(r[0], px), _mm_mul_ps(r[1], py)),
+                                          _mm_mul_ps(r[2], pz)), r[3]);
+        __m128 ny = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(r[4], px), _mm_mul_ps(r[5], py)),
+                                          _mm_mul_ps(r[6], pz)), r[7]);
+        __m128 nz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(r[8], px), _mm_mul_ps(r[9], py)),
+                                          _mm_mul_ps(r[10], pz)), r[11]);
+        _mm_storeu_ps(x + i, nx);
+        _mm_storeu_ps(y + i, ny);
+        _mm_storeu_ps(z + i, nz);
+    }
+    transformScalar(m, x, y, z, i, count);
+}
+
+__attribute__((target("avx2")))
+void transformAvx2(const float* m, float* x, float* y, float* z, size_t count) {
+    __m256 r[12];
+    for (int k = 0; k < 12; ++k) r[k] = _mm256_set1_ps(m[k]);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 px = _mm256_loadu_ps(x + i);
+        __m256 py = _mm256_loadu_ps(y + i);
+        __m256 pz = _mm256_loadu_ps(z + i);
+        __m256 nx = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(r[0], px),
+                                                              _mm256_mul_ps(r[1], py)),
+                                                _mm256_mul_ps(r[2], pz)), r[3]);
+        __m256 ny = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(r[4], px),
+                                                              _mm256_mul_ps(r[5], py)),
+                                                _mm256_mul_ps(r[6], pz)), r[7]);
+        __m256 nz = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(r[8], px),
+                                                              _mm256_mul_ps(r[9], py)),
+                                                _mm256_mul_ps(r[10], pz)), r[11]);
+        _mm256_storeu_ps(x + i, nx);
+        _mm256_storeu_ps(y + i, ny);
+        _mm256_storeu_ps(z + i, nz);
+    }
+    transformScalar(m, x, y, z, i, count);
+}
+
+__attribute__((target("sse2")))
+void projectSse2(const float* m, const float* x, const float* y, const float* z,
+                 float* const out[4], size_t count) {
+    __m128 r[16];
+    for (int k = 0; k < 16; ++k) r[k] = _mm_set1_ps(m[k]);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 px = _mm_loadu_ps(x + i);
+        __m128 py = _mm_loadu_ps(y + i);
+        __m128 pz = _mm_loadu_ps(z + i);
+        for (int row = 0; row < 4; ++row) {
+            const __m128* c = r + row * 4;
+            __m128 v = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(c[0], px), _mm_mul_ps(c[1], py)),
+                                             _mm_mul_ps(c[2], pz)), c[3]);
+            _mm_storeu_ps(out[row] + i, v);
+        }
+    }
+    projectScalar(m, x, y, z, out, i, count);
+}
+
+__attribute__((target("avx2")))
+void projectAvx2(const float* m, const float* x, const float* y, const float* z,
+                 float* const out[4], size_t count) {
+    __m256 r[16];
+    for (int k = 0; k < 16; ++k) r[k] = _mm256_set1_ps(m[k]);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 px = _mm256_loadu_ps(x + i);
+        __m256 py = _mm256_loadu_ps(y + i);
+        __m256 pz = _mm256_loadu_ps(z + i);
+        for (int row = 0; row < 4; ++row) {
+            const __m256* c = r + row * 4;
+            __m256 v = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(c[0], px),
+                                                                 _mm256_mul_ps(c[1], py)),
+                                                   _mm256_mul_ps(c[2], pz)), c[3]);
+            _mm256_storeu_ps(out[row] + i, v);
+        }
+    }
+    projectScalar(m, x, y, z, out, i, count);
+}
+
+__attribute__((target("sse2")))
+void boundsAxisSse2(const float* p, size_t count, float& lo, float& hi) {
+    __m128 vlo = _mm_set1_ps(lo);
+    __m128 vhi = _mm_set1_ps(hi);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 v = _mm_loadu_ps(p + i);
+        vlo = _mm_min_ps(v, vlo);
+        vhi = _mm_max_ps(v, vhi);
+    }
+    float lanesLo[4], lanesHi[4];
+    _mm_storeu_ps(lanesLo, vlo);
+    _mm_storeu_ps(lanesHi, vhi);
+    for (int k = 0; k < 4; ++k) {
+        lo = lanesLo[k] < lo ? lanesLo[k] : lo;
+        hi = lanesHi[k] > hi ? lanesHi[k] : hi;
+    }
+    boundsScalar(p, i, count, lo, hi);
+}
+
+__attribute__((target("avx2")))
+void boundsAxisAvx2(const float* p, size_t count, float& lo, float& hi) {
+    __m256 vlo = _mm256_set1_ps(lo);
+    __m256 vhi = _mm256_set1_ps(hi);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 v = _mm256_loadu_ps(p + i);
+        vlo = _mm256_min_ps(v, vlo);
+        vhi = _mm256_max_ps(v, vhi);
+    }
+    float lanesLo[8], lanesHi[8];
+    _mm256_storeu_ps(lanesLo, vlo);
+    _mm256_storeu_ps(lanesHi, vhi);
+    for (int k = 0; k < 8; ++k) {
+        lo = lanesLo[k] < lo ? lanesLo[k] : lo;
+        hi = lanesHi[k] > hi ? lanesHi[k] : hi;
+    }
+    boundsScalar(p, i, count, lo, hi);
+}
+
+#endif  // S21_KERNEL_X86
+
+}  // namespace
+
+bool IsKernelIsaSupported(KernelIsa isa) {
+    switch (isa) {
+        case KernelIsa::kScalar:
+            return true;
+#if S21_KERNEL_X86
+        case KernelIsa::kSse2:
+            return __builtin_cpu_supports("sse2");
+        case KernelIsa::kAvx2:
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+KernelIsa GetBestKernelIsa() {
+    static const KernelIsa best = []() {
+        if (IsKernelIsaSupported(KernelIsa::kAvx2)) return KernelIsa::kAvx2;
+        if (IsKernelIsaSupported(KernelIsa::kSse2)) return KernelIsa::kSse2;
+        return KernelIsa::kScalar;
+    }();
+    return best;
+}
+
+const char* GetKernelIsaName(KernelIsa isa) {
+    switch (isa) {
+        case KernelIsa::kSse2: return "SSE2";
+        case KernelIsa::kAvx2: return "AVX2";
+        default: return "scalar";
+    }
+}
+
+void TransformPositionsWith(KernelIsa isa, const float matrix[16],
+                            float* x, float* y, float* z, size_t count) {
+    switch (isa) {
+#if S21_KERNEL_X86
+        case KernelIsa::kAvx2:
+            transformAvx2(matrix, x, y, z, count);
+            return;
+        case KernelIsa::kSse2:
+            transformSse2(matrix, x, y, z, count);
+            return;
+#endif
+        default:
+            transformScalar(matrix, x, y, z, 0, count);
+            return;
+    }
+}
+
+void TransformPositions(const float matrix[16], float* x, float* y, float* z, size_t count) {
+    KernelIsa isa = GetBestKernelIsa();
+    size_t blocks = (count + kParallelBlock - 1) / kParallelBlock;
+    ParallelFor(blocks, [&](size_t block) {
+        size_t begin = block * kParallelBlock;
+        size_t size = std::min(kParallelBlock, count - begin);
+        TransformPositionsWith(isa, matrix, x + begin, y + begin, z + begin, size);
+    });
+}
+
+void ProjectPositionsWith(KernelIsa isa, const float matrix[16],
+                          const float* x, const float* y, const float* z,
+                          float* outX, float* outY, float* outZ, float* outW, size_t count) {
+    float* const out[4] = {outX, outY, outZ, outW};
+    switch (isa) {
+#if S21_KERNEL_X86
+        case KernelIsa::kAvx2:
+            projectAvx2(matrix, x, y, z, out, count);
+            return;
+        case KernelIsa::kSse2:
+            projectSse2(matrix, x, y, z, out, count);
+            return;
+#endif
+        default:
+            projectScalar(matrix, x, y, z, out, 0, count);
+            return;
+    }
+}
+
+void ComputePositionBoundsWith(KernelIsa isa, const float* x, const float* y, const float* z,
+                               size_t count, float min[3], float max[3]) {
+    constexpr float kInf = std::numeric_limits<float>::infinity();
+    for (int a = 0; a < 3; ++a) {
+        min[a] = kInf;
+        max[a] = -kInf;
+    }
+    switch (isa) {
+#if S21_KERNEL_X86
+        case KernelIsa::kAvx2:
+            boundsWith(boundsAxisAvx2, x, y, z, count, min, max);
+            return;
+        case KernelIsa::kSse2:
+            boundsWith(boundsAxisSse2, x, y, z, count, min, max);
+            return;
+#endif
+        default:
+            boundsWith(boundsAxisScalar, x, y, z, count, min, max);
+            return;
+    }
+}
+
+void ComputePositionBounds(const float* x, const float* y, const float* z, size_t count,
+                           float min[3], float max[3]) {
+    KernelIsa isa = GetBestKernelIsa();
+    size_t blocks = (count + kParallelBlock - 1) / kParallelBlock;
+    if (blocks <= 1) {
+        ComputePositionBoundsWith(isa, x, y, z, count, min, max);
+        return;
+    }
+
+    std::vector<float> partial(blocks * 6);  // min xyz, max xyz на блок
+    ParallelFor(blocks, [&](size_t block) {
+        size_t begin = block * kParallelBlock;
+        size_t size = std::min(kParallelBlock, count - begin);
+        float* out = partial.data() + block * 6;
+        ComputePositionBoundsWith(isa, x + begin, y + begin, z + begin, size, out, out + 3);
+    });
+
+    std::copy(partial.begin(), partial.begin() + 3, min);
+    std::copy(partial.begin() + 3, partial.begin() + 6, max);
+    for (size_t block = 1; block < blocks; ++block) {
+        const float* out = partial.data() + block * 6;
+        for (int a = 0; a < 3; ++a) {
+            min[a] = out[a] < min[a] ? out[a] : min[a];
+            max[a] = out[3 + a] > max[a] ? out[3 + a] : max[a];
+        }
+    }
+}
+
+}  // namespace s21
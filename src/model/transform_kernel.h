@@ -0,0 +1,72 @@
+// TRANSFORM_KERNEL.H - Пакетная аффинная трансформация массивов координат
+//
+// ЗАЧЕМ НУЖЕН:
+// Mesh хранит координаты тремя массивами float (x, y, z). Применять матрицу
+// к каждой вершине через TransformMatrix::ApplyToPoint (по точке за вызов,
+// в double) слишком медленно для моделей на десятки миллионов вершин.
+// Здесь - специализированное ядро 4x4 для целых массивов.
+//
+// ЧТО СОДЕРЖИТ:
+// - KernelIsa - набор инструкций ядра (scalar / SSE2 / AVX2)
+// - GetBestKernelIsa() - выбор лучшего ядра по CPU во время выполнения
+// - TransformPositions() - трансформация массивов (лучшее ядро + все ядра CPU)
+// - TransformPositionsWith() - трансформация конкретным ядром (для сверки и замеров)
+// - ProjectPositionsWith() - полная матрица 4x4 (проекция) в отдельные массивы
+//   x, y, z, w (clip-координаты); деление на w делает вызывающая сторона
+// - ComputePositionBounds() - min/max по осям (лучшее ядро + все ядра CPU)
+// - ComputePositionBoundsWith() - min/max конкретным ядром (для сверки и замеров)
+//
+// КАК РАБОТАЕТ:
+// 1. Матрица передается как 16 float по строкам (row-major); трансформация
+//    использует только аффинную часть (3 верхние строки), проекция - все 4
+// 2. x' = ((m00*x + m01*y) + m02*z) + m03 - одинаковый порядок операций
+//    во всех ядрах, без FMA (-ffp-contract=off), поэтому результаты побитово совпадают
+// 3. SIMD ядра обрабатывают по 4 (SSE2) или 8 (AVX2) вершин, хвост - скалярно
+// 4. Большие массивы делятся на блоки и обрабатываются параллельно
+// 5. Границы: каждый блок дает свои min/max (minps/maxps), затем блоки
+//    сводятся в один результат; min/max точны, порядок сведения не важен
+//
+// Все в namespace s21
+
+#ifndef TRANSFORM_KERNEL_H_
+#define TRANSFORM_KERNEL_H_
+
+#include <cstddef>
+
+namespace s21 {
+
+enum class KernelIsa { kScalar, kSse2, kAvx2 };
+
+// Лучшее доступное ядро (определяется один раз через cpuid)
+KernelIsa GetBestKernelIsa();
+
+// Проверка доступности ядра на текущем CPU
+bool IsKernelIsaSupported(KernelIsa isa);
+
+const char* GetKernelIsaName(KernelIsa isa);
+
+// Трансформация count вершин на месте: лучшее ядро, параллельно
+void TransformPositions(const float matrix[16], float* x, float* y, float* z, size_t count);
+
+// Трансформация count вершин на месте выбранным ядром в одном потоке
+void TransformPositionsWith(KernelIsa isa, const float matrix[16],
+                            float* x, float* y, float* z, size_t count);
+
+// Clip-координаты count вершин (исходные массивы не меняются) выбранным
+// ядром в одном потоке; параллелит вызывающая сторона (ProjectionCache)
+void ProjectPositionsWith(KernelIsa isa, const float matrix[16],
+                          const float* x, const float* y, const float* z,
+                          float* outX, float* outY, float* outZ, float* outW, size_t count);
+
+// Границы count вершин: min[0..2] и max[0..2] по x, y, z; лучшее ядро, параллельно
+// (count == 0 -> min = +inf, max = -inf)
+void ComputePositionBounds(const float* x, const float* y, const float* z, size_t count,
+                           float min[3], float max[3]);
+
+// Границы count вершин выбранным ядром в одном потоке
+void ComputePositionBoundsWith(KernelIsa isa, const float* x, const float* y, const float* z,
+                               size_t count, float min[3], float max[3]);
+
+}  // namespace s21
+
+#endif  // TRANSFORM_KERNEL_H_
@@ -0,0 +1,178 @@
+// TEST_MODEL.CPP - Тесты Model (Facade) на небольших OBJ файлах
+//
+// ЗАЧЕМ НУЖЕН:
+// Проверяет путь загрузки через Model целиком: конструктор создает
+// FileReader и GeometryCache, LoadMesh() разбирает и нормализует файл,
+// трансформации только накапливают матрицу модели, AddObject() разделяет
+// геометрию между объектами сцены, фоновые загрузки идут через общий
+// FileReader Model, бинарный кэш пишется только в заданный каталог.
+//
+// ЗАПУСК:
+// make test
+//
+// Все в namespace s21
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <string>
+
+#include "../model/io.h"
+#include "../model/mesh_loader.h"
+#include "../model/model.h"
+#include "../model/scene.h"
+
+namespace s21 {
+
+namespace {
+
+namespace fs = std::filesystem;
+
+// Куб 2x2x2 с центром (1, 1, 1): 8 вершин, 6 четырехугольных граней
+constexpr const char* kCubeObj =
+    "v 0 0 0\nv 2 0 0\nv 2 2 0\nv 0 2 0\n"
+    "v 0 0 2\nv 2 0 2\nv 2 2 2\nv 0 2 2\n"
+    "f 1 4 3 2\nf 5 6 7 8\nf 1 2 6 5\n"
+    "f 2 3 7 6\nf 3 4 8 7\nf 4 1 5 8\n";
+
+class ModelTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        dir_ = fs::temp_directory_path() /
+               ("s21_test_model_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) +
+                "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        fs::create_directories(dir_);
+    }
+
+    void TearDown() override {
+        std::error_code ignored;
+        fs::remove_all(dir_, ignored);
+    }
+
+    std::string writeFile(const std::string& name, const std::string& content) {
+        fs::path path = dir_ / name;
+        std::ofstream(path) << content;
+        return path.string();
+    }
+
+    fs::path dir_;
+};
+
+}  // namespace
+
+TEST_F(ModelTest, LoadsAndNormalizesObj) {
+    Model model;
+    FacadeOperationResult result = model.LoadMesh(writeFile("cube.obj", kCubeObj));
+    ASSERT_TRUE(result.IsSuccess()) << result.GetErrorMessage();
+    ASSERT_TRUE(model.HasMesh());
+
+    const Mesh& mesh = model.GetMesh();
+    EXPECT_EQ(mesh.GetVertexCount(), 8u);
+    EXPECT_EQ(mesh.GetEdgeCount(), 12u);      // Диагонали веера не входят в ребра граней
+    EXPECT_EQ(mesh.GetTriangleCount(), 12u);  // 6 граней по 2 треугольника
+
+    // Центр в начале координат, наибольший размер - 1.0 (NormalizationParameters)
+    BoundingBox bounds = mesh.ComputeBounds();
+    EXPECT_NEAR(bounds.min.x, -0.5, 1e-6);
+    EXPECT_NEAR(bounds.max.x, 0.5, 1e-6);
+    EXPECT_NEAR(bounds.min.z, -0.5, 1e-6);
+    EXPECT_NEAR(bounds.max.z, 0.5, 1e-6);
+}
+
+TEST_F(ModelTest, FailedLoadKeepsCurrentMesh) {
+    Model model;
+    ASSERT_TRUE(model.LoadMesh(writeFile("cube.obj", kCubeObj)).IsSuccess());
+    const uint64_t version = model.GetMeshVersion();
+
+    EXPECT_TRUE(model.LoadMesh((dir_ / "missing.obj").string()).IsError());
+    EXPECT_TRUE(model.LoadMesh(writeFile("bad.obj", "v 0 0 0\nf 1 2 3\n")).IsError());
+    EXPECT_EQ(model.GetMesh().GetVertexCount(), 8u);
+    EXPECT_EQ(model.GetMeshVersion(), version);
+}
+
+TEST_F(ModelTest, TransformsOnlyAccumulateModelMatrix) {
+    Model model;
+    ASSERT_TRUE(model.LoadMesh(writeFile("cube.obj", kCubeObj)).IsSuccess());
+    ASSERT_TRUE(model.MoveMesh(1.0, 0.0, 0.0).IsSuccess());
+    ASSERT_TRUE(model.ScaleMesh(2.0, 2.0, 2.0).IsSuccess());
+
+    // Исходные вершины не меняются, мировые - (p + 1) * 2 по X
+    EXPECT_NEAR(model.GetMesh().ComputeBounds().max.x, 0.5, 1e-6);
+    BoundingBox world = model.GetWorldBounds();
+    EXPECT_NEAR(world.min.x, 1.0, 1e-6);
+    EXPECT_NEAR(world.max.x, 3.0, 1e-6);
+    EXPECT_NEAR(world.max.y, 1.0, 1e-6);
+}
+
+TEST_F(ModelTest, VertexPrecisionAppliesToNextLoad) {
+    Model model;
+    model.SetVertexPrecision(VertexPrecision::kBits16);
+    ASSERT_TRUE(model.LoadMesh(writeFile("cube.obj", kCubeObj)).IsSuccess());
+
+    const Mesh& mesh = model.GetMesh();
+    EXPECT_TRUE(mesh.IsCompact());
+    EXPECT_EQ(mesh.GetVertexCount(), 8u);
+    EXPECT_EQ(mesh.GetEdgeCount(), 12u);
+    EXPECT_NEAR(mesh.ComputeBounds().max.y, 0.5, 1e-3);  // Шаг квантования 1/65535 размера
+}
+
+TEST_F(ModelTest, CacheIsOffByDefault) {
+    Model model;
+    ASSERT_TRUE(model.LoadMesh(writeFile("cube.obj", kCubeObj)).IsSuccess());
+    EXPECT_EQ(std::distance(fs::directory_iterator(dir_), fs::directory_iterator()), 1);  // Только cube.obj
+}
+
+TEST_F(ModelTest, CacheDirectoryServesRepeatedLoads) {
+    Model model;
+    const fs::path cacheDir = dir_ / "cache";
+    model.SetCacheDirectory(cacheDir.string());
+    const std::string path = writeFile("cube.obj", kCubeObj);
+    ASSERT_TRUE(model.LoadMesh(path).IsSuccess());
+    EXPECT_EQ(std::distance(fs::directory_iterator(cacheDir), fs::directory_iterator()), 1);
+
+    FacadeOperationResult cached = model.LoadMesh(path);
+    ASSERT_TRUE(cached.IsSuccess());
+    EXPECT_EQ(cached.GetErrorMessage(), "Mesh loaded from cache");
+    EXPECT_EQ(model.GetMesh().GetVertexCount(), 8u);
+    EXPECT_EQ(model.GetMesh().GetEdgeCount(), 12u);
+    EXPECT_EQ(model.GetMesh().GetTriangleCount(), 12u);
+}
+
+TEST_F(ModelTest, AsyncLoadsDeliverMeshes) {
+    Model model;
+    const std::string path = writeFile("cube.obj", kCubeObj);
+    for (int load = 0; load < 2; ++load) {  // Второй раз - тот же FileReader Model
+        std::promise<FacadeOperationResult> finished;
+        MeshLoadHandlers handlers;
+        handlers.on_finished = [&finished](FacadeOperationResult result, MeshAccelerators) {
+            finished.set_value(std::move(result));
+        };
+        ASSERT_TRUE(model.LoadMeshAsync(path, std::move(handlers)).IsSuccess());
+        FacadeOperationResult result = finished.get_future().get();
+        ASSERT_TRUE(result.IsSuccess()) << result.GetErrorMessage();
+        model.SetLoadedMesh(result.TakeMesh());
+        EXPECT_EQ(model.GetMesh().GetVertexCount(), 8u);
+        EXPECT_EQ(model.GetMesh().GetEdgeCount(), 12u);
+    }
+}
+
+TEST_F(ModelTest, SceneObjectsShareGeometry) {
+    Model model;
+    const std::string path = writeFile("cube.obj", kCubeObj);
+    ObjectId first = 0, second = 0;
+    ASSERT_TRUE(model.AddObject(path, TransformMatrix(), &first).IsSuccess());
+    ASSERT_TRUE(model.AddObject(path, TransformMatrixBuilder::CreateMoveMatrix(2, 0, 0), &second)
+                    .IsSuccess());
+
+    EXPECT_NE(first, second);
+    EXPECT_EQ(model.GetScene().GetObjectCount(), 2u);
+    EXPECT_EQ(model.GetScene().GetGeometryCount(), 1u);
+    EXPECT_TRUE(model.AddObject((dir_ / "missing.obj").string()).IsError());
+    EXPECT_EQ(model.GetScene().GetObjectCount(), 2u);
+}
+
+}  // namespace s21
@@ -0,0 +1,421 @@
+// BATCH_RENDERER.CPP - Реализация пакетной отрисовки миниатюр
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - BatchRenderer::Run(): рабочие циклы на ThreadPool, сбор отчетов
+// - GetViewMatrix(): поворот, матрицы Camera (наблюдатель на +Z на
+//   расстоянии Camera::kDefaultDistance) и масштаб по углам ограничивающего
+//   параллелепипеда
+// - Разбор аргументов командной строки и вывод отчета (TSV в stdout)
+//
+// Формат отчета: строка на файл
+//   index  status  vertices  edges  load_ms  render_ms  path  [message]
+// и итоговая строка с общим временем в stderr. --trace <path> после
+// обработки сохраняет замеры Profiler (фазы загрузки и отрисовки) в JSON.
+
+#include "batch_renderer.h"
+
+#include <QImage>
+#include <QPainter>
+#include <QString>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <numbers>
+#include <unordered_map>
+#include <utility>
+
+#include "../model/profiler.h"  // --trace
+
+namespace s21 {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double millisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+std::unique_ptr<SceneDrawerBase> createDrawer(DrawerType type) {
+    if (type == DrawerType::kSoftware) return std::make_unique<SoftwareSceneDrawer>();
+    if (type == DrawerType::kSolid) return std::make_unique<SolidStrategy>();
+    return std::make_unique<QtSceneDrawer>();
+}
+
+// "a,b,c" -> числа; false при пустом или нечисловом элементе
+bool parseNumberList(const char* text, std::vector<double>& out) {
+    out.clear();
+    const char* cursor = text;
+    while (*cursor) {
+        char* end = nullptr;
+        double value = std::strtod(cursor, &end);
+        if (end == cursor || !std::isfinite(value)) return false;
+        out.push_back(value);
+        if (*end == ',') ++end;
+        else if (*end != '\0') return false;
+        cursor = end;
+    }
+    return !out.empty();
+}
+
+// FNV-1a (как в MeshCache): имена не меняются между запусками
+std::string pathHash(const std::string& input) {
+    std::error_code ec;
+    std::filesystem::path absolute = std::filesystem::absolute(input, ec);
+    std::string key = ec ? input : absolute.lexically_normal().string();
+    uint32_t hash = 2166136261u;
+    for (unsigned char c : key) {
+        hash ^= c;
+        hash *= 16777619u;
+    }
+    char text[9];
+    std::snprintf(text, sizeof(text), "%08x", static_cast<unsigned>(hash));
+    return text;
+}
+
+bool readFileList(const std::string& listPath, std::vector<std::string>& files) {
+    std::ifstream list(listPath);
+    if (!list) return false;
+    std::string line;
+    while (std::getline(list, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (!line.empty()) files.push_back(line);
+    }
+    return true;
+}
+
+bool parseColor(const char* text, QColor& color) {
+    QColor parsed(QString::fromUtf8(text));
+    if (!parsed.isValid()) return false;
+    color = parsed;
+    return true;
+}
+
+void printUsage(const char* program) {
+    std::printf(
+        "Usage: %s --batch [options] file.obj [file.obj ...]\n"
+        "  --list <path>          File with one OBJ path per line\n"
+        "  --output <dir>         Output directory (default: .)\n"
+        "  --size <n[,n...]>      Thumbnail sizes in pixels (default: 256)\n"
+        "  --rotate <x,y,z>       Rotation in degrees (default: 0,0,0)\n"
+        "  --projection <type>    parallel | central (default: parallel)\n"
+        "  --renderer <type>      qpainter | software | solid (default: qpainter)\n"
+        "  --jobs <n>             Files rendered concurrently (default: CPU count)\n"
+        "  --cache-dir <dir>      Enable the binary mesh cache in <dir>\n"
+        "  --background <color>   Background color (default: black)\n"
+        "  --line-color <color>   Edge color (default: white)\n"
+        "  --face-color <color>   Lit face color for --renderer solid (default: #c8c8c8)\n"
+        "  --vertex-color <color> Vertex and point cloud color (default: red)\n"
+        "  --vertex-size <px>     Draw vertices of this size (default: 0, off)\n"
+        "  --min-density <n>      Point clouds: points per drawn pixel (default: 1)\n"
+        "  --precision <type>     Vertex storage: float | 16 | 21 bits per axis (default: float)\n"
+        "  --trace <path>         Write load/draw timings as Chrome Trace JSON\n"
+        "Runs without a window; QT_QPA_PLATFORM defaults to offscreen.\n",
+        program);
+}
+
+}  // namespace
+
+// ====== BatchRenderer ======
+
+BatchRenderer::BatchRenderer(BatchOptions options) : options_(std::move(options)) {
+    options_.jobs = std::max(1u, options_.jobs);
+    // Повтор размера дал бы второй файл с тем же именем
+    std::vector<int> sizes;
+    for (int size : options_.sizes) {
+        if (std::find(sizes.begin(), sizes.end(), size) == sizes.end()) sizes.push_back(size);
+    }
+    options_.sizes = std::move(sizes);
+
+    const size_t fileCount = options_.files.size();
+    output_stems_.resize(fileCount);
+    std::unordered_map<std::string, size_t> stemCount;
+    for (size_t i = 0; i < fileCount; ++i) {
+        output_stems_[i] = std::filesystem::path(options_.files[i]).stem().string();
+        ++stemCount[output_stems_[i]];
+    }
+    duplicate_of_.assign(fileCount, kNoDuplicate);
+    std::unordered_map<std::string, size_t> firstByStem;
+    for (size_t i = 0; i < fileCount; ++i) {
+        if (stemCount[output_stems_[i]] > 1) {
+            output_stems_[i] += "_" + pathHash(options_.files[i]);
+        }
+        auto [first, inserted] = firstByStem.emplace(output_stems_[i], i);
+        if (!inserted) duplicate_of_[i] = first->second;
+    }
+}
+
+std::vector<BatchFileReport> BatchRenderer::Run(const ReportHandler& onReport) {
+    const size_t fileCount = options_.files.size();
+    std::vector<BatchFileReport> reports(fileCount);
+    std::atomic<size_t> next{0};
+    std::mutex reportMutex;
+
+    size_t workers = std::min<size_t>(options_.jobs, fileCount);
+    ThreadPool pool(static_cast<unsigned>(workers));
+    pool.ParallelFor(workers, [&](size_t) {
+        FileReader reader;
+        reader.SetCacheEnabled(!options_.cache_dir.empty());
+        if (!options_.cache_dir.empty()) reader.SetCacheDirectory(options_.cache_dir);
+        reader.SetVertexPrecision(options_.precision);
+        std::unique_ptr<SceneDrawerBase> drawer = createDrawer(options_.drawer);
+        PointCloudStrategy points;
+        points.SetMinDensity(options_.min_density);
+
+        for (size_t i = next.fetch_add(1); i < fileCount; i = next.fetch_add(1)) {
+            reports[i] = renderFile(i, reader, *drawer, points);
+            if (onReport) {
+                std::lock_guard<std::mutex> lock(reportMutex);
+                onReport(reports[i]);
+            }
+        }
+    });
+    return reports;
+}
+
+TransformMatrix BatchRenderer::GetViewMatrix(const Mesh& mesh) const {
+    const double toRadians = std::numbers::pi / 180.0;
+    Mat4 view = Mat4::Rotation(options_.rotation_degrees[0] * toRadians,
+                               options_.rotation_degrees[1] * toRadians,
+                               options_.rotation_degrees[2] * toRadians);
+    Camera camera;
+    camera.SetProjectionType(options_.projection);
+    view = camera.GetViewProjection() * view;
+
+    BoundingBox bounds = mesh.ComputeBounds();
+    double extent = 0.0;
+    for (int corner = 0; corner < 8; ++corner) {
+        Vec4 p = view * Vec4{corner & 1 ? bounds.max.x : bounds.min.x,
+                             corner & 2 ? bounds.max.y : bounds.min.y,
+                             corner & 4 ? bounds.max.z : bounds.min.z, 1.0};
+        if (p.w < kNearClipW) continue;  // За камерой (не бывает для нормализованной модели)
+        extent = std::max({extent, std::abs(p.x / p.w), std::abs(p.y / p.w)});
+    }
+    double scale = extent > 0.0 ? kFill / extent : 1.0;
+    return TransformMatrix(Mat4::Scale(scale, scale, 1.0) * view);
+}
+
+std::string BatchRenderer::GetOutputPath(size_t index, int size) const {
+    std::filesystem::path name = output_stems_[index];
+    name += "_" + std::to_string(size) + ".png";
+    return (std::filesystem::path(options_.output_dir) / name).string();
+}
+
+BatchFileReport BatchRenderer::renderFile(size_t index, FileReader& reader, SceneDrawerBase& drawer,
+                                          PointCloudStrategy& points) const {
+    BatchFileReport report;
+    report.index = index;
+    report.path = options_.files[index];
+    if (duplicate_of_[index] != kNoDuplicate) {
+        report.message = "Output name " + output_stems_[index] + " collides with file #" +
+                         std::to_string(duplicate_of_[index]);
+        return report;
+    }
+
+    Clock::time_point loadStart = Clock::now();
+    FacadeOperationResult result = reader.ReadMesh(report.path, NormalizationParameters());
+    report.load_ms = millisecondsSince(loadStart);
+    if (result.IsError()) {
+        report.message = result.GetErrorMessage();
+        return report;
+    }
+    const Mesh& mesh = result.GetMesh();
+    report.vertex_count = mesh.GetVertexCount();
+    report.edge_count = mesh.GetEdgeCount();
+
+    Clock::time_point renderStart = Clock::now();
+    TransformMatrix matrix = GetViewMatrix(mesh);
+    SceneDrawerBase& target = mesh.IsPointCloud() ? points : drawer;
+    for (int size : options_.sizes) {
+        QImage image(size, size, QImage::Format_ARGB32_Premultiplied);
+        image.fill(options_.background);
+        {
+            QPainter painter(&image);
+            target.DrawMesh(painter, mesh, matrix, options_.settings);
+        }
+        std::string output = GetOutputPath(index, size);
+        if (!image.save(QString::fromStdString(output), "PNG")) {
+            report.message = "Cannot write " + output;
+            report.render_ms = millisecondsSince(renderStart);
+            return report;
+        }
+        report.outputs.push_back(std::move(output));
+    }
+    report.render_ms = millisecondsSince(renderStart);
+    report.success = true;
+    return report;
+}
+
+// ====== Командная строка ======
+
+bool IsBatchInvocation(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--batch") == 0) return true;
+    }
+    return false;
+}
+
+bool ParseBatchArguments(int argc, char* argv[], BatchOptions& options, std::string& error) {
+    std::vector<double> numbers;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--batch") continue;
+        if (arg == "--help") {
+            error.clear();
+            return false;
+        }
+        if (arg.rfind("--", 0) != 0) {
+            options.files.push_back(arg);
+            continue;
+        }
+        if (i + 1 >= argc) {
+            error = "Missing value for " + arg;
+            return false;
+        }
+        const char* value = argv[++i];
+
+        if (arg == "--list") {
+            if (!readFileList(value, options.files)) {
+                error = std::string("Cannot read file list ") + value;
+                return false;
+            }
+        } else if (arg == "--output") {
+            options.output_dir = value;
+        } else if (arg == "--size") {
+            if (!parseNumberList(value, numbers)) {
+                error = std::string("Invalid --size ") + value;
+                return false;
+            }
+            options.sizes.clear();
+            for (double size : numbers) {
+                if (size < 1.0 || size > 16384.0) {
+                    error = std::string("Invalid --size ") + value;
+                    return false;
+                }
+                options.sizes.push_back(static_cast<int>(size));
+            }
+        } else if (arg == "--rotate") {
+            if (!parseNumberList(value, numbers) || numbers.size() != 3) {
+                error = std::string("Invalid --rotate ") + value + " (expected x,y,z)";
+                return false;
+            }
+            std::copy(numbers.begin(), numbers.end(), options.rotation_degrees);
+        } else if (arg == "--projection") {
+            if (std::strcmp(value, "parallel") == 0) {
+                options.projection = ProjectionType::kParallel;
+            } else if (std::strcmp(value, "central") == 0) {
+                options.projection = ProjectionType::kCentral;
+            } else {
+                error = std::string("Unknown projection ") + value;
+                return false;
+            }
+        } else if (arg == "--renderer") {
+            if (std::strcmp(value, "qpainter") == 0) {
+                options.drawer = DrawerType::kPainter;
+            } else if (std::strcmp(value, "software") == 0) {
+                options.drawer = DrawerType::kSoftware;
+            } else if (std::strcmp(value, "solid") == 0) {
+                options.drawer = DrawerType::kSolid;
+            } else {
+                error = std::string("Unknown renderer ") + value;
+                return false;
+            }
+        } else if (arg == "--jobs") {
+            if (!parseNumberList(value, numbers) || numbers.size() != 1 || numbers[0] < 1.0) {
+                error = std::string("Invalid --jobs ") + value;
+                return false;
+            }
+            options.jobs = static_cast<unsigned>(numbers[0]);
+        } else if (arg == "--cache-dir") {
+            options.cache_dir = value;
+        } else if (arg == "--trace") {
+            options.trace_path = value;
+        } else if (arg == "--background" || arg == "--line-color" || arg == "--face-color" ||
+                   arg == "--vertex-color") {
+            QColor& color = arg == "--background"   ? options.background
+                            : arg == "--line-color" ? options.settings.line_color
+                            : arg == "--face-color" ? options.settings.face_color
+                                                    : options.settings.vertex_color;
+            if (!parseColor(value, color)) {
+                error = "Invalid " + arg + " " + value;
+                return false;
+            }
+        } else if (arg == "--vertex-size") {
+            if (!parseNumberList(value, numbers) || numbers.size() != 1 || numbers[0] < 0.0) {
+                error = std::string("Invalid --vertex-size ") + value;
+                return false;
+            }
+            options.settings.vertex_size = numbers[0];
+        } else if (arg == "--min-density") {
+            if (!parseNumberList(value, numbers) || numbers.size() != 1 || numbers[0] < 1.0 ||
+                numbers[0] > 65535.0) {
+                error = std::string("Invalid --min-density ") + value;
+                return false;
+            }
+            options.min_density = static_cast<uint32_t>(numbers[0]);
+        } else if (arg == "--precision") {
+            if (std::strcmp(value, "float") == 0) {
+                options.precision = VertexPrecision::kFloat;
+            } else if (std::strcmp(value, "16") == 0) {
+                options.precision = VertexPrecision::kBits16;
+            } else if (std::strcmp(value, "21") == 0) {
+                options.precision = VertexPrecision::kBits21;
+            } else {
+                error = std::string("Unknown precision ") + value;
+                return false;
+            }
+        } else {
+            error = "Unknown option " + arg;
+            return false;
+        }
+    }
+    if (options.files.empty()) {
+        error = "No input files";
+        return false;
+    }
+    return true;
+}
+
+int RunBatchCli(int argc, char* argv[]) {
+    BatchOptions options;
+    std::string error;
+    if (!ParseBatchArguments(argc, argv, options, error)) {
+        if (!error.empty()) std::fprintf(stderr, "%s\n", error.c_str());
+        printUsage(argv[0]);
+        return error.empty() ? 0 : 2;
+    }
+
+    std::error_code ignored;
+    std::filesystem::create_directories(options.output_dir, ignored);
+
+    std::string tracePath = options.trace_path;
+    Clock::time_point start = Clock::now();
+    BatchRenderer renderer(std::move(options));
+    std::vector<BatchFileReport> reports = renderer.Run([](const BatchFileReport& report) {
+        std::printf("%zu\t%s\t%zu\t%zu\t%.1f\t%.1f\t%s%s%s\n", report.index,
+                    report.success ? "ok" : "error", report.vertex_count, report.edge_count,
+                    report.load_ms, report.render_ms, report.path.c_str(),
+                    report.success ? "" : "\t", report.message.c_str());
+        std::fflush(stdout);
+    });
+
+    size_t failed = std::count_if(reports.begin(), reports.end(),
+                                  [](const BatchFileReport& report) { return !report.success; });
+    std::fprintf(stderr, "%zu files, %zu failed, %.1f ms\n", reports.size(), failed,
+                 millisecondsSince(start));
+    if (!tracePath.empty() && !Profiler::Instance().WriteChromeTrace(tracePath)) {
+        std::fprintf(stderr, "Cannot write trace %s\n", tracePath.c_str());
+        return 1;
+    }
+    return failed == 0 ? 0 : 1;
+}
+
+}  // namespace s21
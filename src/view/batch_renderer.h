@@ -0,0 +1,125 @@
+// BATCH_RENDERER.H - Пакетная отрисовка миниатюр без окна (часть View)
+//
+// ЗАЧЕМ НУЖЕН:
+// Превью для десятков тысяч OBJ файлов строятся на серверах без дисплея
+// и GPU. BatchRenderer загружает файлы через FileReader, рисует их теми же
+// стратегиями SceneDrawerBase, что и ModelWidget, в QImage и сохраняет PNG.
+// Окно не создается: достаточно QGuiApplication с QT_QPA_PLATFORM=offscreen.
+//
+// ЧТО СОДЕРЖИТ:
+// - BatchOptions - список файлов, размеры, поворот, проекция, стратегия отрисовки
+// - BatchFileReport - результат по файлу (время загрузки и отрисовки, ошибка)
+// - BatchRenderer класс - обработка списка файлов на пуле потоков
+// - ParseBatchArguments(), RunBatchCli() - режим командной строки (--batch)
+//
+// КАК РАБОТАЕТ:
+// 1. Run() запускает options.jobs задач на ThreadPool; каждая задача -
+//    рабочий цикл со своими FileReader и SceneDrawerBase (буферы разбора
+//    и отрисовки переиспользуются между файлами), файлы разбираются через
+//    атомарный счетчик
+// 2. Вложенные ParallelFor (разбор, нормализация, проекция, растеризация)
+//    внутри задачи пула идут последовательно: параллельность - по файлам
+// 3. На файл: ReadMesh -> матрица вида (модель вписывается в кадр) ->
+//    для каждого размера QImage (фон) -> DrawMesh -> QImage::save
+//    ("<output_dir>/<stem>_<size>.png"). Облако точек (Mesh::IsPointCloud)
+//    рисует PointCloudStrategy рабочего цикла, какой бы ни была стратегия
+// 3a. Имена выходов выбираются в конструкторе: у файлов с одинаковым
+//    stem (a/cube.obj, b/cube.obj) к имени добавляется FNV-1a хэш полного
+//    пути ("<stem>_<hash>_<size>.png"). Файл, чей выход все равно совпал
+//    с выходом более раннего (тот же путь дважды), не рисуется и получает
+//    ошибку в отчете - миниатюры не перезаписывают друг друга
+// 4. Отчет о файле передается в обработчик сразу после обработки
+//    (вызовы обработчика сериализованы), Run() возвращает отчеты
+//    в порядке списка файлов
+//
+// Все в namespace s21
+
+#ifndef BATCH_RENDERER_H_
+#define BATCH_RENDERER_H_
+
+#include <QColor>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../model/io.h"        // FileReader
+#include "../model/model.h"     // Mesh, TransformMatrix
+#include "../model/parallel.h"  // GetWorkerCount
+#include "camera.h"             // Camera, ProjectionType
+#include "rendering.h"          // SceneDrawerBase, PointCloudStrategy, DrawSettings
+
+namespace s21 {
+
+enum class DrawerType {
+    kPainter,   // QtSceneDrawer
+    kSoftware,  // SoftwareSceneDrawer
+    kSolid      // SolidStrategy (залитые грани)
+};
+
+struct BatchOptions {
+    std::vector<std::string> files;
+    std::string output_dir = ".";
+    std::vector<int> sizes{256};           // Квадратные миниатюры size x size
+    double rotation_degrees[3] = {0.0, 0.0, 0.0};
+    ProjectionType projection = ProjectionType::kParallel;
+    DrawerType drawer = DrawerType::kPainter;
+    unsigned jobs = GetWorkerCount();      // Файлов одновременно
+    std::string cache_dir;                 // Пусто - бинарный кэш выключен
+    std::string trace_path;                // Не пусто - замеры Profiler в Chrome Trace
+    uint32_t min_density = 1;              // Облако точек: точек в пикселе, чтобы он был нарисован
+    VertexPrecision precision = VertexPrecision::kFloat;  // Хранение загруженных mesh'ей
+    DrawSettings settings;
+    QColor background = Qt::black;
+};
+
+struct BatchFileReport {
+    size_t index = 0;                      // Номер в BatchOptions::files
+    std::string path;
+    bool success = false;
+    std::string message;                   // Текст ошибки
+    size_t vertex_count = 0;
+    size_t edge_count = 0;
+    double load_ms = 0.0;
+    double render_ms = 0.0;                // Все размеры, включая запись PNG
+    std::vector<std::string> outputs;
+};
+
+class BatchRenderer {
+public:
+    using ReportHandler = std::function<void(const BatchFileReport&)>;
+
+    explicit BatchRenderer(BatchOptions options);
+
+    std::vector<BatchFileReport> Run(const ReportHandler& onReport = {});
+
+    static constexpr double kFill = 0.9;  // Доля короткой стороны кадра под модель
+
+    // Масштаб * (проекция * вид камеры) * поворот: углы ограничивающего параллелепипеда
+    // mesh'а после поворота и проекции вписаны в [-kFill, kFill]
+    TransformMatrix GetViewMatrix(const Mesh& mesh) const;
+    // index - номер в BatchOptions::files
+    std::string GetOutputPath(size_t index, int size) const;
+
+private:
+    static constexpr size_t kNoDuplicate = SIZE_MAX;
+
+    BatchOptions options_;
+    std::vector<std::string> output_stems_;  // Имя выхода без "_<size>.png" для каждого файла
+    std::vector<size_t> duplicate_of_;       // Номер файла с тем же выходом или kNoDuplicate
+
+    BatchFileReport renderFile(size_t index, FileReader& reader, SceneDrawerBase& drawer,
+                               PointCloudStrategy& points) const;
+};
+
+// --batch в аргументах - приложение запускается без окна
+bool IsBatchInvocation(int argc, char* argv[]);
+// false - ошибка в аргументах (текст в error) или --help (error пуст)
+bool ParseBatchArguments(int argc, char* argv[], BatchOptions& options, std::string& error);
+// Разбор аргументов, обработка, отчет в stdout; код возврата процесса
+int RunBatchCli(int argc, char* argv[]);
+
+}  // namespace s21
+
+#endif  // BATCH_RENDERER_H_
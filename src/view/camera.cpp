@@ -0,0 +1,57 @@
+// CAMERA.CPP - Реализация камеры
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - Матрицу вида (перенос вдоль оси Z)
+// - Матрицы параллельной и центральной проекции
+// - Кэш P * V и MVP кадра
+
+#include "camera.h"
+
+#include <algorithm>
+
+#include "projection.h"  // kNearClipW
+
+namespace s21 {
+
+namespace {
+
+// Перспектива с фокусным расстоянием distance: в плоскости z_вида = -distance
+// масштаб 1; z -> [-1, 1] между near и far, w = -z_вида
+Mat4 centralProjection(double distance, double near, double far) {
+    Mat4 result = Mat4::Identity();
+    result(0, 0) = distance;
+    result(1, 1) = distance;
+    result(2, 2) = -(far + near) / (far - near);
+    result(2, 3) = -2.0 * far * near / (far - near);
+    result(3, 2) = -1.0;
+    result(3, 3) = 0.0;
+    return result;
+}
+
+}  // namespace
+
+Camera::Camera() { update(); }
+
+void Camera::SetProjectionType(ProjectionType type) {
+    if (type_ == type) return;
+    type_ = type;
+    update();
+}
+
+void Camera::SetDistance(double distance) {
+    distance_ = std::max(distance, 2.0 * kNearClipW);
+    update();
+}
+
+TransformMatrix Camera::GetModelViewProjection(const TransformMatrix& model) const {
+    return TransformMatrix(view_projection_ * model.GetMat4());
+}
+
+void Camera::update() {
+    view_ = Mat4::Translation(0.0, 0.0, -distance_);
+    projection_ = type_ == ProjectionType::kCentral ? centralProjection(distance_, kNearClipW, kFar)
+                                                    : Mat4::Identity();
+    view_projection_ = projection_ * view_;
+}
+
+}  // namespace s21
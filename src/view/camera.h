@@ -0,0 +1,72 @@
+// CAMERA.H - Камера: матрицы вида и проекции (часть View)
+//
+// ЗАЧЕМ НУЖЕН:
+// Параллельная и центральная проекции - свойство наблюдателя, а не модели.
+// Camera хранит матрицы вида и проекции и их произведение; на кадр
+// остается одно умножение на матрицу модели (MVP), дальше все вершины
+// проецируются одним пакетным проходом (ProjectionCache). Смена типа
+// проекции меняет только матрицы камеры: данные mesh'а не пересчитываются.
+//
+// ЧТО СОДЕРЖИТ:
+// - ProjectionType - параллельная или центральная проекция
+// - Camera класс - положение наблюдателя, тип проекции, матрицы
+//
+// КАК РАБОТАЕТ:
+// 1. Наблюдатель на оси +Z на расстоянии distance, взгляд вдоль -Z:
+//    вид V = перенос (0, 0, -distance)
+// 2. Параллельная проекция: P = единичная матрица (итоговая матрица аффинная,
+//    глубина = -z)
+// 3. Центральная: x, y умножаются на distance и делятся на w = -z_вида, поэтому
+//    масштаб в плоскости z = 0 совпадает с параллельной проекцией; z
+//    отображается в [-1, 1] между kNearClipW и kFar (меньше - ближе)
+// 4. Ближняя плоскость центральной проекции - w = kNearClipW (projection.h),
+//    по ней ProjectionCache отсекает ребра
+// 5. P * V пересчитывается при изменении параметров, GetModelViewProjection()
+//    - одно умножение Mat4 на кадр
+//
+// Без зависимостей от Qt. Все в namespace s21
+
+#ifndef CAMERA_H_
+#define CAMERA_H_
+
+#include "../model/model.h"  // TransformMatrix, Mat4
+
+namespace s21 {
+
+enum class ProjectionType {
+    kParallel,  // Ортографическая
+    kCentral    // Перспективная (камера на оси +Z)
+};
+
+class Camera {
+public:
+    static constexpr double kDefaultDistance = 3.0;  // Модель нормализуется в куб со стороной 1
+    static constexpr double kFar = 1000.0;
+
+    Camera();
+
+    void SetProjectionType(ProjectionType type);
+    ProjectionType GetProjectionType() const { return type_; }
+    void SetDistance(double distance);
+    double GetDistance() const { return distance_; }
+
+    const Mat4& GetViewMatrix() const { return view_; }
+    const Mat4& GetProjectionMatrix() const { return projection_; }
+    const Mat4& GetViewProjection() const { return view_projection_; }  // P * V
+
+    // P * V * model: локальные координаты mesh'а -> clip-пространство
+    TransformMatrix GetModelViewProjection(const TransformMatrix& model) const;
+
+private:
+    ProjectionType type_ = ProjectionType::kParallel;
+    double distance_ = kDefaultDistance;
+    Mat4 view_;
+    Mat4 projection_;
+    Mat4 view_projection_;
+
+    void update();
+};
+
+}  // namespace s21
+
+#endif  // CAMERA_H_
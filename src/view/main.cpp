@@ -26,7 +26,15 @@
 // 7. Запуск главного цикла обработки событий
 // 8. Обработка завершения приложения
 //
+// ПАКЕТНЫЙ РЕЖИМ (--batch, batch_renderer.h):
+// - Окно не создается: QGuiApplication вместо QApplication, платформа Qt
+//   по умолчанию offscreen (QT_QPA_PLATFORM), дисплей и GPU не нужны
+// - Миниатюры PNG для списка файлов, отчет по файлам в stdout
+// - Пример: 3DViewer --batch --list models.txt --size 128,512 --rotate 30,45,0
+//           --projection central --renderer software --output thumbs
+//
 // АРГУМЕНТЫ КОМАНДНОЙ СТРОКИ:
+// - --batch - пакетный режим (остальные аргументы - см. --batch --help)
 // - --style <style> - выбор стиля Qt
 // - --theme <theme> - выбор темы (светлая/темная)
 // - --file <path> - автоматическая загрузка файла при запуске
@@ -39,3 +47,32 @@
 // - Инициализация системы логирования
 //
 // Все в namespace s21
+
+#include <QApplication>
+#include <QDir>
+#include <QGuiApplication>
+#include <QStandardPaths>
+#include <QtGlobal>
+
+#include "../controller/controller.h"
+#include "../model/model.h"
+#include "batch_renderer.h"
+#include "mainwindow.h"
+
+int main(int argc, char* argv[]) {
+    if (s21::IsBatchInvocation(argc, argv)) {
+        if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) qputenv("QT_QPA_PLATFORM", "offscreen");
+        QGuiApplication app(argc, argv);
+        return s21::RunBatchCli(argc, argv);
+    }
+
+    QApplication app(argc, argv);
+    s21::Model model;
+    // Бинарный кэш моделей - в каталоге кэша пользователя, не рядом с OBJ
+    QString cache_root = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    if (!cache_root.isEmpty()) model.SetCacheDirectory(QDir(cache_root).filePath("meshes").toStdString());
+    s21::MainWindow window;
+    s21::Controller controller(&model, &window);  // Разрушается первым - до окна и Model
+    window.show();
+    return app.exec();
+}
@@ -35,3 +35,132 @@
 // - Только сигналы для отправки команд в Controller
 // - Только слоты для получения данных от Controller
 // - Отображение состояния модели без прямого доступа к данным
+//
+// ФОНОВАЯ ЗАГРУЗКА:
+// - File > Open: QFileDialog -> emit signalLoadFile()
+// - showLoadProgress(): QProgressBar в строке состояния (байты файла;
+//   без размера - бегущая полоса), действие "Cancel" становится доступным
+// - Cancel -> emit signalCancelLoad(); Controller завершает загрузку
+//   вызовом clearPreview(), который прячет полосу и выключает "Cancel"
+// - showPreview()/clearPreview() передают черновой mesh в ModelWidget
+
+#include "mainwindow.h"
+
+#include <QAction>
+#include <QFileDialog>
+#include <QFileInfo>
+#include <QKeySequence>
+#include <QLabel>
+#include <QMenu>
+#include <QMenuBar>
+#include <QMessageBox>
+#include <QProgressBar>
+#include <QStatusBar>
+#include <QToolBar>
+
+namespace s21 {
+
+namespace {
+
+constexpr int kProgressSteps = 1000;  // Разрешение QProgressBar по байтам файла
+
+}  // namespace
+
+MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent) {
+    setWindowTitle(tr("3DViewer"));
+    model_widget_ = new ModelWidget(this);
+    setCentralWidget(model_widget_);
+    connect(model_widget_, &ModelWidget::signalTransform, this, &MainWindow::signalTransform);
+    createActions();
+    createStatusBar();
+    resize(1024, 768);
+}
+
+void MainWindow::setModel(const Model* model) {
+    model_ = model;
+    model_widget_->setModel(model);
+    updateModelInfo();
+}
+
+void MainWindow::createActions() {
+    QMenu* file_menu = menuBar()->addMenu(tr("&File"));
+    QAction* open_action = file_menu->addAction(tr("&Open..."), this, &MainWindow::openFile);
+    open_action->setShortcut(QKeySequence::Open);
+    cancel_action_ = file_menu->addAction(tr("&Cancel loading"), this, &MainWindow::signalCancelLoad);
+    cancel_action_->setShortcut(QKeySequence::Cancel);
+    cancel_action_->setEnabled(false);
+    file_menu->addSeparator();
+    QAction* exit_action = file_menu->addAction(tr("E&xit"), this, &QWidget::close);
+    exit_action->setShortcut(QKeySequence::Quit);
+
+    QToolBar* tool_bar = addToolBar(tr("File"));
+    tool_bar->addAction(open_action);
+    tool_bar->addAction(cancel_action_);
+}
+
+void MainWindow::createStatusBar() {
+    info_label_ = new QLabel(this);
+    statusBar()->addWidget(info_label_, 1);
+    load_progress_ = new QProgressBar(this);
+    load_progress_->setMaximumWidth(200);
+    load_progress_->setVisible(false);
+    statusBar()->addPermanentWidget(load_progress_);
+}
+
+void MainWindow::openFile() {
+    QString path = QFileDialog::getOpenFileName(this, tr("Open model"), QString(),
+                                                tr("Wavefront OBJ (*.obj);;All files (*)"));
+    if (path.isEmpty()) return;
+    emit signalLoadFile(path.toStdString());
+}
+
+void MainWindow::setLoading(bool loading) {
+    load_progress_->setVisible(loading);
+    cancel_action_->setEnabled(loading);
+    if (!loading) load_progress_->reset();
+}
+
+void MainWindow::showLoadProgress(const LoadProgress& progress) {
+    setLoading(true);
+    if (progress.total_bytes == 0) {
+        load_progress_->setRange(0, 0);  // Размер неизвестен - бегущая полоса
+    } else {
+        load_progress_->setRange(0, kProgressSteps);
+        load_progress_->setValue(static_cast<int>(progress.bytes_read * kProgressSteps / progress.total_bytes));
+    }
+    statusBar()->showMessage(tr("Loading: %1 vertices, %2 faces")
+                                 .arg(static_cast<qulonglong>(progress.vertices))
+                                 .arg(static_cast<qulonglong>(progress.faces)));
+}
+
+void MainWindow::showPreview(std::shared_ptr<const Mesh> preview) {
+    model_widget_->setPreviewMesh(std::move(preview));
+}
+
+void MainWindow::clearPreview() {
+    model_widget_->clearPreview();
+    setLoading(false);
+    statusBar()->clearMessage();
+}
+
+void MainWindow::showError(const std::string& message) {
+    QMessageBox::warning(this, tr("Error"), QString::fromStdString(message));
+}
+
+void MainWindow::updateModelInfo() {
+    if (!model_ || !model_->HasMesh()) {
+        info_label_->setText(tr("No model loaded"));
+        return;
+    }
+    const Mesh& mesh = model_->GetMesh();
+    info_label_->setText(tr("%1: %2 vertices, %3 edges")
+                             .arg(QFileInfo(QString::fromStdString(mesh.GetFilename())).fileName())
+                             .arg(static_cast<qulonglong>(mesh.GetVertexCount()))
+                             .arg(static_cast<qulonglong>(mesh.GetEdgeCount())));
+}
+
+void MainWindow::updateDisplay() {
+    model_widget_->updateModel();
+}
+
+}  // namespace s21
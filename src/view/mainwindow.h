@@ -23,6 +23,9 @@
 // 3. Controller обновляет данные -> updateModelInfo(), updateDisplay()
 // 4. Model виджет отображает 3D mesh
 // 5. Обработка событий мыши для интерактивного управления
+// 6. Во время фоновой загрузки: showLoadProgress() (QProgressBar в строке
+//    состояния), showPreview() (черновой mesh в ModelWidget), кнопка
+//    "Отмена" -> emit signalCancelLoad(); clearPreview() по завершении
 //
 // ПРИНЦИПЫ MVC:
 // - НИКАКОЙ бизнес-логики, только UI
@@ -32,22 +35,56 @@
 //
 // Все в namespace s21
 
-namespace s21 {
-    class MainWindow : public QMainWindow {
-        // UI элементы: кнопки, поля ввода, ModelWidget
-    };
-}
+#ifndef MAINWINDOW_H_
+#define MAINWINDOW_H_
+
+#include <QMainWindow>
+#include <memory>
+#include <string>
+
+#include "../model/io.h"     // LoadProgress
+#include "../model/model.h"  // Model, Mesh
+#include "modelwidget.h"
+
+class QAction;
+class QLabel;
+class QProgressBar;
 
-// src/view/modelwidget.h
 namespace s21 {
-    class ModelWidget : public QWidget {
-        Model* model_;
+    class MainWindow : public QMainWindow {
+        Q_OBJECT
+        
+    public:
+        explicit MainWindow(QWidget* parent = nullptr);
+        
+        // Только чтение: информация о mesh'е и кадры ModelWidget (Controller)
+        void setModel(const Model* model);
         
-    protected:
-        void paintEvent(QPaintEvent* event) override;
+    public slots:
+        void showLoadProgress(const LoadProgress& progress);  // Первый вызов - начало загрузки
+        void showPreview(std::shared_ptr<const Mesh> preview);
+        void clearPreview();                                  // Конец загрузки (успех, ошибка, отмена)
+        void showError(const std::string& message);
+        void updateModelInfo();
+        void updateDisplay();
+        
+    signals:
+        void signalLoadFile(const std::string& path);
+        void signalCancelLoad();
+        void signalTransform(const TransformMatrix& step);  // ModelWidget::signalTransform
         
     private:
-        void drawScene(const Scene& scene);
-        void project3DTo2D(const 3DPoint& point3d, QPoint& point2d);
+        const Model* model_ = nullptr;
+        ModelWidget* model_widget_ = nullptr;     // Центральный виджет
+        QLabel* info_label_ = nullptr;            // Файл, вершины, ребра
+        QProgressBar* load_progress_ = nullptr;   // Виден только во время загрузки
+        QAction* cancel_action_ = nullptr;        // Доступна только во время загрузки
+        
+        void createActions();
+        void createStatusBar();
+        void openFile();                          // QFileDialog -> emit signalLoadFile()
+        void setLoading(bool loading);
     };
 }
+
+#endif  // MAINWINDOW_H_
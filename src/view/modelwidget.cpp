@@ -6,40 +6,220 @@
 // стандартных Qt инструментов для 2D отрисовки.
 //
 // ЧТО РЕАЛИЗУЕТ:
-// - paintEvent() - отрисовка 3D модели через QPainter
+// - paintEvent() - вывод последнего готового кадра RenderPipeline
+// - requestFrame() - снимок состояния виджета и Model в запрос кадра
 // - updateModel() - обновление данных модели и перерисовка
 // - Отрисовка каркасной модели (линии между вершинами)
 // - Настройки отображения (цвета, толщина линий, размер вершин)
 // - Поддержка разных типов проекции (параллельная/центральная)
 // - Обработка событий мыши (поворот, масштабирование, перемещение)
 // - Интеграция с QtSceneDrawer для отрисовки
-// - Простая 3D проекция: ортогональная проекция 3D координат в 2D экранные
+// - Проекция через Camera: параллельная или центральная (MVP на кадр)
 //
 // КАК РАБОТАЕТ:
-// 1. paintEvent():
-//    - Создание QPainter для отрисовки
-//    - Очистка фона виджета
+// 1. Кадр (поток отрисовки, FrameRenderer):
+//    - Очистка фона кадра
 //    - Проекция 3D координат в 2D экранные координаты
 //    - Отрисовка линий между вершинами
 //    - Отрисовка вершин как точек
+//    paintEvent() только копирует готовый кадр в окно
 // 2. Обработка событий мыши:
 //    - Вычисление углов поворота на основе движения мыши
 //    - Обновление параметров отображения
 //    - Перерисовка сцены
-// 3. Простая 3D проекция:
-//    - Ортогональная проекция (без перспективы)
-//    - Поворот вокруг осей X, Y, Z
-//    - Масштабирование и перемещение
+// 3. Проекция:
+//    - Camera: параллельная или центральная (наблюдатель на оси +Z),
+//      ребра за ближней плоскостью обрезаются (ProjectionCache)
+//    - Поворот, масштабирование и перемещение - матрица модели
 //
 // ОПТИМИЗАЦИЯ:
 // - Кэширование спроецированных координат
 // - Отрисовка только видимых частей модели
-// - Упрощенная геометрия для больших моделей
-// - Асинхронная обработка событий
+// - Упрощенная геометрия для больших моделей: во время ввода рисуется
+//   уровень MeshLodChain, бюджет ребер = ребра / время кадра * kFrameBudgetMs
+//   (среднее геометрическое с прошлым бюджетом, чтобы не скакать между уровнями)
+// - Асинхронная обработка событий: кадр рисуется в потоке отрисовки,
+//   GUI поток не ждет растеризации; устаревший кадр бросается
+// - Объединение ввода: события мыши за тик frame_clock_ складываются в одну
+//   матрицу, Model и перерисовка получают один шаг на кадр
+// - Замер кадра ("frame") и панель ProfilerOverlay (setProfilerOverlay)
 //
 // НАСТРОЙКИ ОТОБРАЖЕНИЯ:
 // - Цвет фона (QPalette)
 // - Цвет и толщина линий (QPen)
 // - Цвет и размер вершин (QBrush, QPen)
 // - Тип проекции (ортографическая/перспективная)
-// - Настройки камеры (углы поворота, масштаб)
\ No newline at end of file
+// - Настройки камеры (углы поворота, масштаб)
+
+#include "modelwidget.h"
+
+#include <QMetaObject>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QWheelEvent>
+#include <algorithm>
+#include <cmath>
+
+#include "../model/profiler.h"  // S21_PROFILE_SCOPE
+
+namespace s21 {
+
+namespace {
+
+constexpr double kRotatePerPixel = 0.01;     // Радиан на пиксель перетаскивания
+constexpr double kScalePerWheelStep = 1.1;   // Один шаг колесика (120 единиц)
+
+}  // namespace
+
+// Кадр готов в потоке отрисовки - update() переносится в GUI поток
+ModelWidget::ModelWidget(QWidget* parent)
+    : QWidget(parent),
+      pipeline_([this] { QMetaObject::invokeMethod(this, [this] { update(); }, Qt::QueuedConnection); }) {
+    setAttribute(Qt::WA_OpaquePaintEvent);  // Фон заливается в paintEvent
+    settle_timer_.setSingleShot(true);
+    settle_timer_.setInterval(kSettleMs);
+    connect(&settle_timer_, &QTimer::timeout, this, &ModelWidget::endInteraction);
+    frame_clock_.setInterval(kFrameIntervalMs);
+    connect(&frame_clock_, &QTimer::timeout, this, &ModelWidget::onFrameTick);
+}
+
+void ModelWidget::setModel(const Model* model) {
+    model_ = model;
+    updateModel();
+}
+
+void ModelWidget::updateModel() {
+    requestFrame(true);
+}
+
+void ModelWidget::setDrawSettings(const DrawSettings& settings) {
+    settings_ = settings;
+    requestFrame();  // Цвета и толщины не влияют на кэш проекции
+}
+
+void ModelWidget::setBackgroundColor(const QColor& color) {
+    background_ = color;
+    requestFrame();
+}
+
+void ModelWidget::setProjectionType(ProjectionType type) {
+    if (camera_.GetProjectionType() == type) return;
+    camera_.SetProjectionType(type);
+    requestFrame();  // Новая MVP: кэш проекции пересчитается по ключу матрицы
+}
+
+void ModelWidget::setPreviewMesh(std::shared_ptr<const Mesh> preview) {
+    preview_ = std::move(preview);
+    requestFrame();
+}
+
+void ModelWidget::clearPreview() {
+    if (!preview_) return;
+    preview_.reset();
+    requestFrame();
+}
+
+void ModelWidget::setProfilerOverlay(bool visible) {
+    if (show_profiler_ == visible) return;
+    show_profiler_ = visible;
+    update();
+}
+
+void ModelWidget::setSolidShading(bool enabled) {
+    if (solid_ == enabled) return;
+    solid_ = enabled;
+    requestFrame();
+}
+
+void ModelWidget::requestFrame(bool invalidateCaches) {
+    FrameRequest request;
+    if (model_) request.model = model_->GetSnapshot();
+    request.preview = preview_;
+    request.camera = camera_;
+    request.settings = settings_;
+    request.background = background_;
+    request.width = width();
+    request.height = height();
+    request.solid = solid_;
+    request.interacting = interacting_;
+    request.invalidate_caches = invalidateCaches;
+    pipeline_.Submit(std::move(request));
+}
+
+void ModelWidget::paintEvent(QPaintEvent* /*event*/) {
+    QPainter painter(this);
+    {
+        S21_PROFILE_SCOPE("frame: blit", kFrame);
+        if (!pipeline_.PaintFront(painter, background_)) painter.fillRect(rect(), background_);
+    }
+    if (show_profiler_) profiler_overlay_.Paint(painter, rect());  // Не входит в замер кадра
+}
+
+void ModelWidget::resizeEvent(QResizeEvent* /*event*/) {
+    requestFrame();
+}
+
+void ModelWidget::beginInteraction() {
+    settle_timer_.stop();
+    if (!interacting_) {
+        interacting_ = true;
+        requestFrame();
+    }
+}
+
+void ModelWidget::endInteraction() {
+    if (drag_buttons_ != Qt::NoButton) return;  // Кнопка еще нажата
+    interacting_ = false;
+    requestFrame();  // Полная детализация
+}
+
+void ModelWidget::queueInput(const TransformMatrix& step) {
+    pending_input_ = step.Multiply(pending_input_);  // Новый шаг - после накопленных
+    has_pending_input_ = true;
+    if (!frame_clock_.isActive()) frame_clock_.start();
+}
+
+void ModelWidget::onFrameTick() {
+    if (!has_pending_input_) {
+        frame_clock_.stop();  // Ввода нет - часы не будят цикл событий
+        return;
+    }
+    TransformMatrix step = pending_input_;
+    pending_input_ = TransformMatrix();
+    has_pending_input_ = false;
+    emit signalTransform(step);
+}
+
+void ModelWidget::mousePressEvent(QMouseEvent* event) {
+    drag_buttons_ = event->buttons();
+    last_pos_ = event->position().toPoint();
+    beginInteraction();
+}
+
+void ModelWidget::mouseMoveEvent(QMouseEvent* event) {
+    if (drag_buttons_ == Qt::NoButton) return;
+    QPoint pos = event->position().toPoint();
+    QPoint delta = pos - last_pos_;
+    last_pos_ = pos;
+    if (drag_buttons_ & Qt::LeftButton) {
+        queueInput(TransformMatrixBuilder::CreateRotationMatrix(delta.y() * kRotatePerPixel,
+                                                                delta.x() * kRotatePerPixel, 0.0));
+    } else if (drag_buttons_ & Qt::RightButton) {
+        double half = std::max(1, std::min(width(), height())) * 0.5;
+        queueInput(TransformMatrixBuilder::CreateMoveMatrix(delta.x() / half, -delta.y() / half, 0.0));
+    }
+}
+
+void ModelWidget::mouseReleaseEvent(QMouseEvent* event) {
+    drag_buttons_ = event->buttons();
+    if (drag_buttons_ == Qt::NoButton) settle_timer_.start();
+}
+
+void ModelWidget::wheelEvent(QWheelEvent* event) {
+    beginInteraction();
+    double factor = std::pow(kScalePerWheelStep, event->angleDelta().y() / 120.0);
+    queueInput(TransformMatrixBuilder::CreateScaleMatrix(factor, factor, factor));
+    if (drag_buttons_ == Qt::NoButton) settle_timer_.start();
+}
+
+}  // namespace s21
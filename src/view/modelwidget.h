@@ -16,11 +16,53 @@
 // - Простая 3D проекция: ортогональная проекция 3D координат в 2D экранные
 //
 // КАК РАБОТАЕТ:
-// 1. paintEvent(): отрисовка 3D модели через QPainter
-// 2. updateModel(): обновление данных модели и перерисовка
+// 1. paintEvent(): только выводит последний готовый кадр RenderPipeline
+//    (render_pipeline.h) - проекция и растеризация идут в потоке отрисовки.
+//    Каждое изменение (updateModel, настройки, камера, размер, ввод)
+//    вызывает requestFrame(): запрос кадра со снимком Model
+//    (model_->GetSnapshot(): mesh по shared_ptr, матрица, сцена) и копиями
+//    camera_ и settings_. Незаконченный кадр бросается, если пришел запрос
+//    новее; до первого готового кадра окно заливается фоном
+//    Сам кадр (FrameRenderer): одна матрица MVP = camera_ (проекция * вид) *
+//    модель; тип проекции (setProjectionType) меняет только camera_
+//    Рисует QtSceneDrawer: проекция кэшируется между кадрами (перерисовка
+//    без смены матрицы и размера не проецирует вершины заново); при
+//    приближении большой модели - только ячейки индекса EdgeGrid, попавшие
+//    в окно
+//    Затем объекты сцены: на объект одна MVP = camera_ * модель * матрица
+//    объекта, общая геометрия не копируется; у объектов свой QtSceneDrawer,
+//    чтобы не сбрасывать кэш проекции основного mesh'а
+//    Во время фоновой загрузки рисуется черновой mesh (setPreviewMesh),
+//    он уже нормализован; clearPreview() возвращает отрисовку model_
+// 2. updateModel(): новый кадр со сбросом кэшей стратегий
 // 3. mousePressEvent/mouseMoveEvent: обработка интерактивного управления
+//    (поворот, перемещение)
 // 4. wheelEvent: масштабирование колесиком мыши
+// 4b. Объединение ввода: события мыши не отправляются по одному. Каждое
+//    событие домножает накопленную матрицу шага; часы кадра frame_clock_
+//    (kFrameIntervalMs) раз в тик отправляют одну составную матрицу -
+//    signalTransform (MainWindow передает ее в Controller::onTransformModel).
+//    Тик без нового ввода останавливает часы. Задержка перетаскивания - не
+//    больше одного тика, сколько бы событий ни пришло
+// 4a. Упрощенная геометрия: пока нажата кнопка мыши или крутится колесико
+//    (и еще kSettleMs после), рисуется уровень LOD, который укладывается в
+//    бюджет ребер кадра (у объектов сцены - поровну на каждый объект).
+//    Бюджет подстраивается по времени прошлых кадров под
+//    FrameRenderer::kFrameBudgetMs (60 fps). Когда ввод прекратился,
+//    кадр перерисовывается с полной моделью
 // 5. keyPressEvent: управление клавиатурой (поворот, сброс)
+// 4c. Залитые грани: setSolidShading(true) рисует основной mesh через
+//    SolidStrategy (буфер глубины, плоское освещение); у уровней LOD нет
+//    граней, поэтому во время ввода рисуется полная модель. Черновой mesh
+//    и объекты сцены остаются каркасом
+// 4d. Облака точек (Mesh::IsPointCloud: вершины без ребер) рисует
+//    PointCloudStrategy - основной mesh, черновой и объекты сцены. Во время
+//    ввода рисуется каждая k-я точка в пределах того же бюджета кадра (точка
+//    считается как ребро), после ввода - все точки
+// 6. Профилирование: кадр в потоке отрисовки замеряется как "frame"
+//    (брошенный - "frame: dropped"), вывод в paintEvent - "frame: blit";
+//    setProfilerOverlay(true) рисует поверх кадра ProfilerOverlay -
+//    гистограмму времени кадров и фазы последней загрузки
 //
 // ИНТЕРАКТИВНОЕ УПРАВЛЕНИЕ:
 // - ЛКМ + перетаскивание: поворот модели
@@ -35,3 +77,90 @@
 // - Интерактивные действия отправляет в Controller через сигналы
 //
 // Все в namespace s21
+
+#ifndef MODELWIDGET_H_
+#define MODELWIDGET_H_
+
+#include <QColor>
+#include <QPoint>
+#include <QTimer>
+#include <QWidget>
+#include <memory>
+
+#include "../model/model.h"     // Model, Mesh
+#include "camera.h"             // Camera, ProjectionType
+#include "profiler_overlay.h"   // ProfilerOverlay
+#include "render_pipeline.h"    // RenderPipeline, FrameRequest
+#include "rendering.h"          // DrawSettings
+
+namespace s21 {
+    class ModelWidget : public QWidget {
+        Q_OBJECT
+        
+    public:
+        static constexpr int kSettleMs = 150;               // Пауза ввода до полной детализации
+        static constexpr int kFrameIntervalMs = 16;         // Тик часов ввода (~60 Гц)
+        
+        explicit ModelWidget(QWidget* parent = nullptr);
+        
+        void setModel(const Model* model);
+        void updateModel();                                    // Новый mesh -> перерисовка
+        void setDrawSettings(const DrawSettings& settings);
+        void setBackgroundColor(const QColor& color);
+        // Меняет только матрицы камеры: mesh и кэши модели не пересчитываются
+        void setProjectionType(ProjectionType type);
+        ProjectionType getProjectionType() const { return camera_.GetProjectionType(); }
+        void setPreviewMesh(std::shared_ptr<const Mesh> preview);
+        void clearPreview();
+        void setProfilerOverlay(bool visible);
+        bool isProfilerOverlayVisible() const { return show_profiler_; }
+        void setSolidShading(bool enabled);
+        bool isSolidShading() const { return solid_; }
+        
+    signals:
+        // Все повороты, перемещения и масштабы мыши за тик одной матрицей
+        // (применяется после матрицы модели, как Model::TransformMesh)
+        void signalTransform(const TransformMatrix& step);
+        
+    protected:
+        void paintEvent(QPaintEvent* event) override;
+        void resizeEvent(QResizeEvent* event) override;
+        void mousePressEvent(QMouseEvent* event) override;
+        void mouseMoveEvent(QMouseEvent* event) override;
+        void mouseReleaseEvent(QMouseEvent* event) override;
+        void wheelEvent(QWheelEvent* event) override;
+        
+    private:
+        const Model* model_ = nullptr;
+        std::shared_ptr<const Mesh> preview_;  // Черновой mesh во время загрузки
+        bool solid_ = false;
+        Camera camera_;
+        DrawSettings settings_;
+        QColor background_ = Qt::black;
+        ProfilerOverlay profiler_overlay_;
+        bool show_profiler_ = false;
+        
+        // Интерактивный режим: грубый уровень детализации
+        bool interacting_ = false;
+        Qt::MouseButtons drag_buttons_ = Qt::NoButton;
+        QPoint last_pos_;
+        QTimer settle_timer_;                    // Однократный, kSettleMs после ввода
+        
+        // Объединение ввода
+        QTimer frame_clock_;                     // Периодический, kFrameIntervalMs
+        TransformMatrix pending_input_;          // Шаги с прошлого тика (последний - слева)
+        bool has_pending_input_ = false;
+        
+        // Поток отрисовки; последним полем - останавливается первым, пока
+        // остальные поля еще живы
+        RenderPipeline pipeline_;
+        
+        void requestFrame(bool invalidateCaches = false);  // Снимок состояния -> pipeline_
+        void beginInteraction();
+        void endInteraction();                   // По settle_timer_
+        void queueInput(const TransformMatrix& step);
+        void onFrameTick();
+    };
+}
+
+#endif  // MODELWIDGET_H_
@@ -0,0 +1,217 @@
+// POINT_SPLATTER.CPP - Реализация отрисовки облака точек
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - Проекцию кусков точек SIMD ядром и запись атомарным минимумом глубины
+//   (std::atomic_ref над обычным буфером - без массива std::atomic)
+// - Ключ глубины: float -> uint32 с тем же порядком
+// - Счетчик попаданий для порога плотности
+// - Разрешение кадра по полосам строк: диапазон глубины, затемнение,
+//   заполнение дыр по числу занятых соседей
+
+#include "point_splatter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "../model/model.h"             // Mesh
+#include "../model/transform_kernel.h"  // ProjectPositionsWith
+#include "projection.h"                 // kNearClipW
+
+namespace s21 {
+
+namespace {
+
+constexpr uint32_t kEmpty = std::numeric_limits<uint32_t>::max();
+constexpr int kBandRows = 64;   // Строк в одной параллельной задаче Resolve
+
+// Порядок ключей совпадает с порядком глубин (меньше - ближе)
+inline uint32_t depthKey(float depth) {
+    uint32_t bits;
+    std::memcpy(&bits, &depth, sizeof(bits));
+    return bits & 0x80000000u ? ~bits : bits | 0x80000000u;
+}
+
+inline float keyDepth(uint32_t key) {
+    uint32_t bits = key & 0x80000000u ? key & 0x7fffffffu : ~key;
+    float depth;
+    std::memcpy(&depth, &bits, sizeof(depth));
+    return depth;
+}
+
+inline void storeMin(uint32_t& slot, uint32_t key) {
+    std::atomic_ref<uint32_t> target(slot);
+    uint32_t current = target.load(std::memory_order_relaxed);
+    while (key < current && !target.compare_exchange_weak(current, key, std::memory_order_relaxed)) {
+    }
+}
+
+uint32_t scalePixel(uint32_t color, float intensity) {
+    uint32_t r = uint32_t(float((color >> 16) & 0xff) * intensity + 0.5f);
+    uint32_t g = uint32_t(float((color >> 8) & 0xff) * intensity + 0.5f);
+    uint32_t b = uint32_t(float(color & 0xff) * intensity + 0.5f);
+    return (color & 0xff000000u) | (r << 16) | (g << 8) | b;
+}
+
+}  // namespace
+
+PointSplatter::PointSplatter(ThreadPool& pool) : pool_(pool) {}
+
+void PointSplatter::Resize(int width, int height) {
+    width = std::max(width, 0);
+    height = std::max(height, 0);
+    if (width == width_ && height == height_) return;
+    width_ = width;
+    height_ = height;
+    depth_.assign(size_t(width) * height, kEmpty);
+    color_.assign(size_t(width) * height, 0);
+    hits_.clear();
+}
+
+static_assert(PointSplatter::kChunk == PositionChunk::kSize);
+
+size_t PointSplatter::Splat(const Mesh& mesh, const Mat4& combined, const PointSplatOptions& options) {
+    std::fill(depth_.begin(), depth_.end(), kEmpty);
+    const bool countHits = options.min_density > 1;
+    if (countHits) hits_.assign(depth_.size(), 0);
+    const size_t stride = std::max<size_t>(options.stride, 1);
+    const size_t count = (mesh.GetVertexCount() + stride - 1) / stride;
+    if (count == 0 || depth_.empty()) return 0;
+
+    float m[16];
+    combined.ToFloatArray(m);
+    const bool affine = combined(3, 0) == 0.0 && combined(3, 1) == 0.0 && combined(3, 2) == 0.0 &&
+                        combined(3, 3) == 1.0;
+    const KernelIsa isa = GetBestKernelIsa();
+    const float nearW = float(kNearClipW);
+    const int size = std::max(options.size, 1), half = size / 2;
+
+    pool_.ParallelFor((count + kBlock - 1) / kBlock, [&](size_t block) {
+        if (abandon_ && (*abandon_)()) return;
+        PositionChunk gathered;  // Собранные (stride > 1) или раскодированные точки
+        float cx[kChunk], cy[kChunk], cz[kChunk], cw[kChunk];
+        size_t end = std::min(count, (block + 1) * kBlock);
+        for (size_t first = block * kBlock; first < end; first += kChunk) {
+            size_t chunk = std::min(kChunk, end - first);
+            PositionPointers source = mesh.ReadPositions(first * stride, chunk, gathered, stride);
+            ProjectPositionsWith(isa, m, source.x, source.y, source.z, cx, cy, cz, cw, chunk);
+            for (size_t i = 0; i < chunk; ++i) {
+                float sxp = cx[i], syp = cy[i], depth = -cz[i];
+                if (!affine) {
+                    if (!(cw[i] >= nearW)) continue;
+                    float inverse = 1.0f / cw[i];
+                    sxp *= inverse, syp *= inverse, depth = cz[i] * inverse;
+                }
+                // Центры пикселей - целые координаты
+                if (!(sxp >= -0.5f && sxp < width_ - 0.5f && syp >= -0.5f && syp < height_ - 0.5f)) {
+                    continue;
+                }
+                int column = int(sxp + 0.5f), row = int(syp + 0.5f);
+                uint32_t key = depthKey(depth);
+                int x0 = std::max(column - half, 0), x1 = std::min(column - half + size - 1, width_ - 1);
+                int y0 = std::max(row - half, 0), y1 = std::min(row - half + size - 1, height_ - 1);
+                for (int py0 = y0; py0 <= y1; ++py0) {
+                    for (int px0 = x0; px0 <= x1; ++px0) {
+                        size_t pixel = size_t(py0) * width_ + px0;
+                        storeMin(depth_[pixel], key);
+                        if (countHits) {
+                            std::atomic_ref<uint32_t>(hits_[pixel]).fetch_add(1, std::memory_order_relaxed);
+                        }
+                    }
+                }
+            }
+        }
+    });
+    return count;
+}
+
+inline bool PointSplatter::isVisible(size_t pixel, uint32_t minDensity) const {
+    return depth_[pixel] != kEmpty && (minDensity <= 1 || hits_[pixel] >= minDensity);
+}
+
+void PointSplatter::Resolve(uint32_t color, const PointSplatOptions& options) {
+    const uint32_t minDensity = options.min_density;
+    const size_t bands = size_t((height_ + kBandRows - 1) / kBandRows);
+    if (minDensity > 1 && hits_.size() != depth_.size()) hits_.assign(depth_.size(), 0);
+
+    // 1. Диапазон глубины видимых пикселей
+    std::vector<uint32_t> nearest(bands, kEmpty), farthest(bands, 0);
+    pool_.ParallelFor(bands, [&](size_t band) {
+        size_t begin = band * kBandRows * size_t(width_);
+        size_t end = std::min(depth_.size(), begin + kBandRows * size_t(width_));
+        for (size_t pixel = begin; pixel < end; ++pixel) {
+            if (!isVisible(pixel, minDensity)) continue;
+            nearest[band] = std::min(nearest[band], depth_[pixel]);
+            farthest[band] = std::max(farthest[band], depth_[pixel]);
+        }
+    });
+    uint32_t nearKey = *std::min_element(nearest.begin(), nearest.end());
+    uint32_t farKey = *std::max_element(farthest.begin(), farthest.end());
+    const float nearDepth = nearKey == kEmpty ? 0.0f : keyDepth(nearKey);
+    const float range = nearKey == kEmpty ? 0.0f : keyDepth(farKey) - nearDepth;
+    const float shadeScale = range > 0.0f ? (1.0f - kFarShade) / range : 0.0f;
+
+    // 2. Цвет: затемнение по глубине, дыры - ближайший из занятых соседей.
+    //    Маски видимости трех строк и их суммы по столбцам: число занятых
+    //    соседей - сумма трех столбцов, соседи читаются только у кандидатов
+    std::vector<size_t> covered(bands, 0);
+    const size_t width = size_t(width_);
+    pool_.ParallelFor(bands, [&](size_t band) {
+        std::vector<uint8_t> masks(3 * width, 0), columns(width, 0);
+        auto fillMask = [&](int row, uint8_t* mask) {
+            if (row < 0 || row >= height_) {
+                std::fill(mask, mask + width, uint8_t(0));
+                return;
+            }
+            size_t first = size_t(row) * width;
+            for (size_t column = 0; column < width; ++column) mask[column] = isVisible(first + column, minDensity);
+        };
+        int rowBegin = int(band) * kBandRows;
+        int rowEnd = std::min(height_, rowBegin + kBandRows);
+        uint8_t *above = masks.data(), *current = above + width, *below = current + width;
+        fillMask(rowBegin - 1, above);
+        fillMask(rowBegin, current);
+        for (int row = rowBegin; row < rowEnd; ++row) {
+            fillMask(row + 1, below);
+            if (options.fill_holes) {
+                for (size_t column = 0; column < width; ++column) {
+                    columns[column] = uint8_t(above[column] + current[column] + below[column]);
+                }
+            }
+            size_t first = size_t(row) * width;
+            for (size_t column = 0; column < width; ++column) {
+                size_t pixel = first + column;
+                uint32_t key = kEmpty;
+                if (current[column]) {
+                    key = depth_[pixel];
+                } else if (options.fill_holes && row > 0 && column > 0 && row + 1 < height_ &&
+                           column + 1 < width &&
+                           columns[column - 1] + columns[column] + columns[column + 1] >= kFillNeighbors) {
+                    const uint8_t* rows[3] = {above, current, below};
+                    for (int dy = -1; dy <= 1; ++dy) {
+                        for (int dx = -1; dx <= 1; ++dx) {
+                            if (rows[dy + 1][column + dx]) {
+                                key = std::min(key, depth_[pixel + ptrdiff_t(dy) * width_ + dx]);
+                            }
+                        }
+                    }
+                }
+                if (key == kEmpty) {
+                    color_[pixel] = 0;
+                    continue;
+                }
+                ++covered[band];
+                color_[pixel] = scalePixel(color, 1.0f - (keyDepth(key) - nearDepth) * shadeScale);
+            }
+            std::swap(above, current);  // Строки сдвигаются: текущая -> верхняя, нижняя -> текущая
+            std::swap(current, below);
+        }
+    });
+    covered_ = 0;
+    for (size_t band : covered) covered_ += band;
+}
+
+}  // namespace s21
@@ -0,0 +1,104 @@
+// POINT_SPLATTER.H - Отрисовка облака точек прямо в буфер кадра
+//
+// ЗАЧЕМ НУЖЕН:
+// Облака точек (сканы LiDAR: только строки "v", 100M+ точек, граней нет)
+// не помещаются в общий путь отрисовки: ProjectionCache держит 12 байт
+// экранных координат на вершину, SoftwareRasterizer раскладывает точки по
+// плиткам - еще 4 байта. Здесь точка проецируется и сразу пишется в буфер
+// глубины; память кадра зависит только от размера экрана, на точку - ноль.
+//
+// ЧТО СОДЕРЖИТ:
+// - PointSplatOptions - прореживание, размер, порог плотности, заполнение дыр
+// - PointSplatter класс - буфер глубины, счетчик попаданий и буфер цвета
+//   (ARGB32 premultiplied)
+//
+// КАК РАБОТАЕТ:
+// 1. Splat(): точки делятся на блоки (ParallelFor), блок проецируется
+//    SIMD ядром ProjectPositionsWith кусками по kChunk (буферы на стеке);
+//    при stride > 1 берется каждая stride-я точка (куском собирается заранее).
+//    Кусок берется через Mesh::ReadPositions - сжатый Mesh (mesh_codec.h)
+//    раскодируется прямо в буферы на стеке
+// 2. Глубина переводится в uint32 с сохранением порядка (биты float, у
+//    отрицательных - инверсия) и пишется атомарным минимумом (CAS) -
+//    потоки не блокируются, результат не зависит от порядка точек и
+//    числа потоков. Точка за ближней плоскостью (w < kNearClipW) отбрасывается
+// 3. Порог плотности (min_density > 1): в каждый пиксель считаются попадания
+//    (atomic fetch_add), пиксель с меньшим числом точек не рисуется -
+//    одиночные выбросы скана пропадают, плотные поверхности остаются
+// 4. Resolve() по строкам: цвет пикселя - color с затемнением по глубине
+//    (ближняя точка кадра - полная яркость, дальняя - kFarShade), иначе
+//    плотное облако выглядит плоским силуэтом
+// 5. Заполнение дыр, зависящее от плотности (fill_holes): где точки на
+//    экране реже пикселей (дальний план, приближение), между ними остаются
+//    пустые пиксели. Пустой пиксель, у которого заняты не меньше
+//    kFillNeighbors из 8 соседей, получает ближайшего соседа - точка
+//    "растет" только внутри поверхности: в плотных областях дыр нет, край
+//    облака и одиночные точки (меньше соседей) не расширяются
+// 6. Отмена (SetAbandonCheck): блок Splat() сначала спрашивает проверку,
+//    после отмены оставшиеся блоки не проецируются
+//
+// Без зависимостей от Qt. Все в namespace s21
+
+#ifndef POINT_SPLATTER_H_
+#define POINT_SPLATTER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../model/mat4.h"      // Mat4
+#include "../model/parallel.h"  // ThreadPool
+
+namespace s21 {
+
+class Mesh;
+
+struct PointSplatOptions {
+    size_t stride = 1;           // Каждая stride-я точка (бюджет кадра во время ввода)
+    int size = 1;                // Квадрат size x size пикселей
+    uint32_t min_density = 1;    // Точек в пикселе, чтобы он был нарисован
+    bool fill_holes = true;
+
+    bool operator==(const PointSplatOptions&) const = default;
+};
+
+class PointSplatter {
+public:
+    static constexpr size_t kChunk = 512;          // Точек в одном вызове ядра
+    static constexpr size_t kBlock = 1u << 16;     // Точек в одной параллельной задаче
+    static constexpr int kFillNeighbors = 5;
+    static constexpr float kFarShade = 0.35f;
+
+    explicit PointSplatter(ThreadPool& pool = ThreadPool::Shared());
+
+    void Resize(int width, int height);
+    // nullptr - без отмены; проверка должна жить, пока идет Splat()
+    void SetAbandonCheck(const AbandonCheck* check) { abandon_ = check; }
+
+    // combined - ViewportMatrix * MVP (точка -> пиксели); буферы очищаются.
+    // Возвращает число спроецированных точек (с учетом stride)
+    size_t Splat(const Mesh& mesh, const Mat4& combined, const PointSplatOptions& options);
+    // Буфер глубины -> цвет (фон прозрачный); color - premultiplied ARGB
+    void Resolve(uint32_t color, const PointSplatOptions& options);
+
+    int GetWidth() const { return width_; }
+    int GetHeight() const { return height_; }
+    const uint32_t* GetPixels() const { return color_.data(); }  // Строка = width пикселей
+    size_t GetCoveredCount() const { return covered_; }          // Нарисованных пикселей
+
+private:
+    ThreadPool& pool_;
+    int width_ = 0;
+    int height_ = 0;
+    std::vector<uint32_t> depth_;    // Ключ глубины; kEmpty - нет точки
+    std::vector<uint32_t> hits_;     // Попадания (только при min_density > 1)
+    std::vector<uint32_t> color_;
+    size_t covered_ = 0;
+    const AbandonCheck* abandon_ = nullptr;
+
+    bool isVisible(size_t pixel, uint32_t minDensity) const;
+};
+
+}  // namespace s21
+
+#endif  // POINT_SPLATTER_H_
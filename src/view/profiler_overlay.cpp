@@ -0,0 +1,160 @@
+// PROFILER_OVERLAY.CPP - Реализация панели замеров
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - Выборку кадров и фаз последней загрузки из снимка Profiler
+// - Гистограмму времени кадра и таблицу фаз загрузки (QPainter)
+
+#include "profiler_overlay.h"
+
+#include <QColor>
+#include <QString>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "../model/profiler.h"
+
+namespace s21 {
+
+namespace {
+
+constexpr int kPanelWidth = 280;
+constexpr int kPadding = 8;
+constexpr int kLineHeight = 16;
+constexpr int kHistogramHeight = 60;
+constexpr size_t kMaxPhases = 10;
+
+bool named(const ProfileEvent& event, const char* name) {
+    return event.name && std::strcmp(event.name, name) == 0;
+}
+
+bool prefixed(const ProfileEvent& event, const char* prefix) {
+    return event.name && std::strncmp(event.name, prefix, std::strlen(prefix)) == 0;
+}
+
+// Фазы последней загрузки: имя -> суммарная длительность (в порядке появления).
+// "read" записывается по окончании, поэтому фазы выбираются по времени начала:
+// внутри "read" и "load: *" (LOD, индекс) после него до следующей загрузки.
+// "parse: *" - куски в потоках пула, уже учтены в "read: parse"
+std::vector<std::pair<const char*, double>> loadPhases(const std::vector<ProfileEvent>& events,
+                                                       double& totalMs) {
+    std::vector<std::pair<const char*, double>> phases;
+    totalMs = 0.0;
+    auto read = std::find_if(events.rbegin(), events.rend(),
+                             [](const ProfileEvent& event) { return named(event, "read"); });
+    if (read == events.rend()) return phases;
+    const uint64_t begin = read->start_ns, end = read->start_ns + read->duration_ns;
+    totalMs = read->duration_ns / 1e6;
+
+    auto ownThread = [&](const ProfileEvent& event) {
+        return event.category == ProfileCategory::kLoad && event.thread == read->thread;
+    };
+    uint64_t limit = UINT64_MAX;  // Начало следующей загрузки
+    for (const ProfileEvent& event : events) {
+        if (ownThread(event) && event.start_ns > end && !prefixed(event, "load: ")) {
+            limit = std::min(limit, event.start_ns);
+        }
+    }
+    for (const ProfileEvent& event : events) {
+        if (!ownThread(event) || &event == &*read || prefixed(event, "parse: ")) continue;
+        bool inside = event.start_ns >= begin && event.start_ns <= end;
+        bool after = prefixed(event, "load: ") && event.start_ns > end && event.start_ns < limit;
+        if (!inside && !after) continue;
+        auto same = std::find_if(phases.begin(), phases.end(), [&](const auto& phase) {
+            return std::strcmp(phase.first, event.name) == 0;
+        });
+        if (same == phases.end()) {
+            if (phases.size() == kMaxPhases) continue;
+            phases.emplace_back(event.name, 0.0);
+            same = phases.end() - 1;
+        }
+        same->second += event.duration_ns / 1e6;
+    }
+    return phases;
+}
+
+QColor frameColor(double milliseconds) {
+    if (milliseconds <= ProfilerOverlay::kFrameBudgetMs) return QColor(80, 200, 80);
+    if (milliseconds <= 2.0 * ProfilerOverlay::kFrameBudgetMs) return QColor(230, 200, 60);
+    return QColor(230, 70, 60);
+}
+
+}  // namespace
+
+void ProfilerOverlay::Paint(QPainter& painter, const QRect& area) const {
+    painter.save();
+    QRect panel(area.left() + kPadding, area.top() + kPadding, kPanelWidth, kLineHeight + 2 * kPadding);
+    painter.setPen(Qt::white);
+
+    if (!S21_PROFILING) {
+        painter.fillRect(panel, QColor(0, 0, 0, 170));
+        painter.drawText(panel.adjusted(kPadding, kPadding, -kPadding, -kPadding), Qt::AlignLeft,
+                         QString("Profiling disabled (S21_PROFILING=0)"));
+        painter.restore();
+        return;
+    }
+
+    std::vector<ProfileEvent> events = Profiler::Instance().Snapshot();
+    std::vector<double> frames;
+    size_t dropped = 0;  // Брошенные кадры среди показанных на гистограмме
+    for (auto it = events.rbegin(); it != events.rend() && int(frames.size()) < kHistogramFrames; ++it) {
+        if (named(*it, "frame")) frames.push_back(it->duration_ns / 1e6);
+        if (named(*it, "frame: dropped")) ++dropped;
+    }
+    std::reverse(frames.begin(), frames.end());
+    double loadMs = 0.0;
+    std::vector<std::pair<const char*, double>> phases = loadPhases(events, loadMs);
+
+    int lines = 1 + (phases.empty() ? 0 : 1 + int(phases.size()));
+    panel.setHeight(2 * kPadding + kHistogramHeight + kPadding + lines * kLineHeight);
+    painter.fillRect(panel, QColor(0, 0, 0, 170));
+
+    // Гистограмма кадров
+    QRect chart(panel.left() + kPadding, panel.top() + kPadding, kPanelWidth - 2 * kPadding, kHistogramHeight);
+    double barWidth = double(chart.width()) / kHistogramFrames;
+    double average = 0.0, worst = 0.0;
+    for (size_t i = 0; i < frames.size(); ++i) {
+        double height = std::min(frames[i] / kScaleMs, 1.0) * chart.height();
+        QRectF bar(chart.left() + i * barWidth, chart.bottom() + 1 - height, std::max(barWidth - 1.0, 1.0),
+                   height);
+        painter.fillRect(bar, frameColor(frames[i]));
+        average += frames[i];
+        worst = std::max(worst, frames[i]);
+    }
+    if (!frames.empty()) average /= double(frames.size());
+    int budgetY = chart.bottom() + 1 - int(kFrameBudgetMs / kScaleMs * chart.height());
+    painter.setPen(QColor(255, 255, 255, 120));
+    painter.drawLine(chart.left(), budgetY, chart.right(), budgetY);
+
+    // Текст: кадры и фазы загрузки
+    painter.setPen(Qt::white);
+    int y = chart.bottom() + kPadding;
+    auto text = [&](const QString& line) {
+        painter.drawText(QRect(chart.left(), y, chart.width(), kLineHeight), Qt::AlignLeft | Qt::AlignVCenter,
+                         line);
+        y += kLineHeight;
+    };
+    text(QString("frame avg %1 ms, max %2 ms (%3, dropped %4)")
+             .arg(average, 0, 'f', 1)
+             .arg(worst, 0, 'f', 1)
+             .arg(frames.size())
+             .arg(dropped));
+    if (phases.empty()) {
+        painter.restore();
+        return;
+    }
+    double phaseSum = 0.0;
+    for (const auto& phase : phases) phaseSum += phase.second;
+    text(QString("last load %1 ms").arg(loadMs, 0, 'f', 1));
+    for (const auto& [name, milliseconds] : phases) {
+        text(QString("  %1  %2 ms  %3%")
+                 .arg(QString::fromUtf8(name), -22)
+                 .arg(milliseconds, 8, 'f', 1)
+                 .arg(phaseSum > 0.0 ? milliseconds * 100.0 / phaseSum : 0.0, 4, 'f', 0));
+    }
+    painter.restore();
+}
+
+}  // namespace s21
@@ -0,0 +1,44 @@
+// PROFILER_OVERLAY.H - Панель замеров поверх ModelWidget (часть View)
+//
+// ЗАЧЕМ НУЖЕН:
+// Показывает замеры Profiler прямо в окне просмотра: сколько длятся кадры
+// и из каких фаз сложилась последняя загрузка модели. Пользователь видит,
+// что именно медленно, без внешних инструментов.
+//
+// ЧТО СОДЕРЖИТ:
+// - ProfilerOverlay класс - отрисовка панели через QPainter
+//
+// КАК РАБОТАЕТ:
+// 1. Paint() берет Profiler::Snapshot() (только пока панель видна)
+// 2. Гистограмма: последние kHistogramFrames событий "frame", столбец -
+//    длительность кадра (шкала kScaleMs), линия - бюджет 60 fps; цвет
+//    зеленый / желтый / красный по 1 и 2 бюджетам; рядом - число брошенных
+//    за то же время кадров "frame: dropped" (RenderPipeline)
+// 3. Загрузка: последнее событие "read" и события kLoad его потока,
+//    начатые внутри него, плюс следующие за ним "load: *" (LOD, индекс);
+//    длительности одинаковых фаз суммируются, доля - от суммы фаз
+// 4. Замеры выключены (S21_PROFILING = 0) - панель сообщает об этом
+//
+// Все в namespace s21
+
+#ifndef PROFILER_OVERLAY_H_
+#define PROFILER_OVERLAY_H_
+
+#include <QPainter>
+#include <QRect>
+
+namespace s21 {
+
+class ProfilerOverlay {
+public:
+    static constexpr int kHistogramFrames = 120;
+    static constexpr double kScaleMs = 50.0;         // Высота гистограммы
+    static constexpr double kFrameBudgetMs = 1000.0 / 60.0;
+
+    // area - область виджета, панель рисуется в ее левом верхнем углу
+    void Paint(QPainter& painter, const QRect& area) const;
+};
+
+}  // namespace s21
+
+#endif  // PROFILER_OVERLAY_H_
@@ -0,0 +1,211 @@
+// PROJECTION.CPP - Реализация проекции вершин в экранные координаты
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - ViewportMatrix(): [-1, 1] по короткой стороне -> пиксели, ось Y вниз
+// - PointProjector: проекция точки (double, результат во float), ребра
+//   с обрезкой по ближней плоскости и углов параллелепипеда
+// - projectRange(): проекция диапазона вершин SIMD ядром кусками по
+//   kProjectChunk (clip-координаты во временных массивах на стеке; сжатые
+//   вершины раскодируются кусками туда же - Mesh::ReadPositions)
+// - ProjectionCache::Update(): проверка ключа и параллельная проекция
+// - ProjectionCache::clipEdges(): список ребер с обрезкой по ближней плоскости
+
+#include "projection.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "../model/parallel.h"
+#include "../model/transform_kernel.h"  // ProjectPositionsWith
+
+namespace s21 {
+
+namespace {
+
+constexpr size_t kProjectBlock = 1u << 16;   // Вершин в одной параллельной задаче
+
+constexpr size_t kProjectChunk = PositionChunk::kSize;  // Вершин в одном вызове ядра
+
+// Возвращает число вершин за ближней плоскостью
+size_t projectRange(KernelIsa isa, const float m[16], bool affine, const Mesh& mesh,
+                    ScreenVertex* out, uint8_t* behind, size_t begin, size_t end) {
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float nearW = float(kNearClipW);
+    float cx[kProjectChunk], cy[kProjectChunk], cz[kProjectChunk], cw[kProjectChunk];
+    PositionChunk decoded;
+    size_t behindCount = 0;
+    for (size_t first = begin; first < end; first += kProjectChunk) {
+        size_t count = std::min(kProjectChunk, end - first);
+        PositionPointers p = mesh.ReadPositions(first, count, decoded);
+        ProjectPositionsWith(isa, m, p.x, p.y, p.z, cx, cy, cz, cw, count);
+        ScreenVertex* dst = out + first;
+        if (affine) {
+            for (size_t i = 0; i < count; ++i) dst[i] = ScreenVertex{cx[i], cy[i], -cz[i]};
+            continue;
+        }
+        // Центральная проекция: (viewport * clip) / w == viewport * (clip / w)
+        for (size_t i = 0; i < count; ++i) {
+            bool hidden = cw[i] < nearW;
+            behind[first + i] = hidden;
+            behindCount += hidden;
+            float inverse = 1.0f / cw[i];
+            dst[i] = hidden ? ScreenVertex{nan, nan, nan}
+                            : ScreenVertex{cx[i] * inverse, cy[i] * inverse, cz[i] * inverse};
+        }
+    }
+    return behindCount;
+}
+
+}  // namespace
+
+Mat4 ViewportMatrix(int width, int height) {
+    double halfW = width * 0.5;
+    double halfH = height * 0.5;
+    double scale = std::min(halfW, halfH);
+    Mat4 result = Mat4::Identity();
+    result(0, 0) = scale;
+    result(0, 3) = halfW;
+    result(1, 1) = -scale;
+    result(1, 3) = halfH;
+    return result;
+}
+
+// ====== PointProjector ======
+
+PointProjector::PointProjector(const Mat4& combined)
+    : matrix_(combined),
+      affine_(combined(3, 0) == 0.0 && combined(3, 1) == 0.0 && combined(3, 2) == 0.0 &&
+              combined(3, 3) == 1.0) {}
+
+BoxProjection PointProjector::ProjectBox(const float min[3], const float max[3], ScreenRect& rect) const {
+    const Mat4& m = matrix_;
+    rect = ScreenRect{std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                      std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+    int behind = 0;
+    for (int corner = 0; corner < 8; ++corner) {
+        double x = (corner & 1) ? max[0] : min[0];
+        double y = (corner & 2) ? max[1] : min[1];
+        double z = (corner & 4) ? max[2] : min[2];
+        if (!affine_ && m(3, 0) * x + m(3, 1) * y + m(3, 2) * z + m(3, 3) < kNearClipW) {
+            ++behind;
+            continue;
+        }
+        ScreenVertex p = (*this)(x, y, z);
+        rect.min_x = std::min(rect.min_x, p.x);
+        rect.min_y = std::min(rect.min_y, p.y);
+        rect.max_x = std::max(rect.max_x, p.x);
+        rect.max_y = std::max(rect.max_y, p.y);
+    }
+    if (behind == 0) return BoxProjection::kProjected;
+    return behind == 8 ? BoxProjection::kBehind : BoxProjection::kCrossing;
+}
+
+bool PointProjector::ProjectEdge(const Vec3& from, const Vec3& to, ScreenVertex& a,
+                                 ScreenVertex& b) const {
+    if (affine_) {
+        a = (*this)(from.x, from.y, from.z);
+        b = (*this)(to.x, to.y, to.z);
+        return true;
+    }
+    Vec4 p = matrix_ * Vec4{from.x, from.y, from.z, 1.0};
+    Vec4 q = matrix_ * Vec4{to.x, to.y, to.z, 1.0};
+    bool pBehind = p.w < kNearClipW, qBehind = q.w < kNearClipW;
+    if (pBehind && qBehind) return false;
+    // Точка пересечения с плоскостью w = kNearClipW (интерполяция в clip-пространстве)
+    auto clip = [](const Vec4& inside, const Vec4& outside) {
+        double t = (inside.w - kNearClipW) / (inside.w - outside.w);
+        return Vec4{inside.x + (outside.x - inside.x) * t, inside.y + (outside.y - inside.y) * t,
+                    inside.z + (outside.z - inside.z) * t, kNearClipW};
+    };
+    if (pBehind) p = clip(q, p);
+    if (qBehind) q = clip(p, q);
+    a = ScreenVertex{float(p.x / p.w), float(p.y / p.w), float(p.z / p.w)};
+    b = ScreenVertex{float(q.x / q.w), float(q.y / q.w), float(q.z / q.w)};
+    return true;
+}
+
+// ====== ProjectionCache ======
+
+bool ProjectionCache::Update(const Mesh& mesh, const TransformMatrix& matrix, int width, int height) {
+    std::span<const uint32_t> edges = mesh.GetEdgeIndices();  // Пусто у сжатого mesh'а
+    const size_t count = mesh.GetVertexCount();
+    Mat4 combined = ViewportMatrix(width, height) * matrix.GetMat4();
+    if (valid_ && source_ == mesh.GetStorageKey() && count_ == count && edge_source_ == edges.data() &&
+        edge_count_ == mesh.GetEdgeCount() && width_ == width && height_ == height && matrix_ == combined) {
+        return false;
+    }
+
+    vertices_.resize(count);
+    const bool affine = PointProjector(combined).IsAffine();
+    if (!affine) behind_.resize(count);
+    float m[16];
+    combined.ToFloatArray(m);
+    const KernelIsa isa = GetBestKernelIsa();
+    size_t blocks = (count + kProjectBlock - 1) / kProjectBlock;
+    std::vector<size_t> behindCounts(blocks, 0);
+    ParallelFor(blocks, [&](size_t block) {
+        size_t begin = block * kProjectBlock;
+        size_t end = std::min(count, begin + kProjectBlock);
+        behindCounts[block] = projectRange(isa, m, affine, mesh, vertices_.data(), behind_.data(),
+                                           begin, end);
+    });
+
+    valid_ = true;
+    source_ = mesh.GetStorageKey();
+    edge_source_ = edges.data();
+    count_ = count;
+    edge_count_ = mesh.GetEdgeCount();
+    const CompactGeometry* compact = mesh.GetCompact();
+    edge_stream_ = compact ? &compact->edges : nullptr;
+    matrix_ = combined;
+    width_ = width;
+    height_ = height;
+    clipped_count_ = 0;
+    for (size_t behind : behindCounts) clipped_count_ += behind;
+    if (clipped_count_ == 0) {
+        edges_ = edges;
+    } else {
+        clipEdges(mesh);
+    }
+    return true;
+}
+
+void ProjectionCache::clipEdges(const Mesh& mesh) {
+    PointProjector project(matrix_);
+    clipped_edges_.clear();
+    // Сжатые ребра раскодируются по блоку; список с обрезкой - обычный массив
+    std::span<const uint32_t> edges = mesh.GetEdgeIndices();
+    uint32_t decoded[EdgeStream::kBlockEdges * 2];
+    const size_t blocks = edge_stream_ ? edge_stream_->GetBlockCount() : 1;
+    for (size_t block = 0; block < blocks; ++block) {
+        if (edge_stream_) edges = {decoded, edge_stream_->DecodeBlock(block, decoded) * 2};
+        clipBlock(project, mesh, edges);
+    }
+    edges_ = clipped_edges_;
+    edge_stream_ = nullptr;
+}
+
+void ProjectionCache::clipBlock(const PointProjector& project, const Mesh& mesh,
+                                std::span<const uint32_t> edges) {
+    for (size_t e = 0; e < edges.size(); e += 2) {
+        uint32_t a = edges[e], b = edges[e + 1];
+        if (!behind_[a] && !behind_[b]) {
+            clipped_edges_.push_back(a);
+            clipped_edges_.push_back(b);
+            continue;
+        }
+        if (behind_[a] && behind_[b]) continue;
+        // Видимый конец остается, вместо скрытого - точка на ближней плоскости
+        ScreenVertex from, to;
+        float p[3], q[3];
+        mesh.ReadPosition(a, p);
+        mesh.ReadPosition(b, q);
+        project.ProjectEdge(Vec3{p[0], p[1], p[2]}, Vec3{q[0], q[1], q[2]}, from, to);
+        uint32_t added = uint32_t(vertices_.size());
+        vertices_.push_back(behind_[a] ? from : to);
+        clipped_edges_.push_back(behind_[a] ? added : a);
+        clipped_edges_.push_back(behind_[a] ? b : added);
+    }
+}
+
+}  // namespace s21
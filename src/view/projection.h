@@ -0,0 +1,141 @@
+// PROJECTION.H - Проекция вершин mesh'а в экранные координаты (часть View)
+//
+// ЗАЧЕМ НУЖЕН:
+// Обе реализации отрисовки (QtSceneDrawer через QPainter и SoftwareSceneDrawer
+// с собственным растеризатором) сначала переводят вершины в пиксели.
+// Проекция делается один раз и кэшируется между кадрами: перерисовка без
+// смены матрицы и размера виджета не трогает вершины. Ребра, уходящие за
+// ближнюю плоскость центральной проекции, обрезаются по ней.
+//
+// ЧТО СОДЕРЖИТ:
+// - ScreenVertex - вершина в пикселях (x вправо, y вниз) и глубина
+// - kNearClipW - ближняя плоскость отсечения (w = kNearClipW)
+// - ScreenRect - прямоугольник в пикселях
+// - ViewportMatrix() - [-1, 1] по короткой стороне -> пиксели
+// - PointProjector - проекция отдельных точек, ребер и параллелепипедов
+// - BoxProjection - положение параллелепипеда относительно наблюдателя
+// - ProjectionCache - кэш экранных координат всех вершин mesh'а
+//
+// КАК РАБОТАЕТ:
+// 1. MVP кадра (Camera::GetModelViewProjection) и область вывода ([-1, 1] по
+//    короткой стороне -> пиксели) объединяются в одну матрицу
+// 2. Вершины проецируются блоками на всех ядрах (ParallelFor), внутри блока -
+//    SIMD ядро ProjectPositionsWith (transform_kernel.h) в clip-координаты
+//    x, y, z, w, затем деление на w
+// 3. Нижняя строка матрицы (0, 0, 0, 1) - параллельная проекция, взгляд вдоль -Z:
+//    глубина = -z; иначе - центральная: деление на w, глубина = z / w
+//    (в обоих случаях меньшая глубина - ближе к наблюдателю)
+// 4. Вершины с w < kNearClipW (за ближней плоскостью) получают координаты NaN;
+//    если такие есть, строится отдельный список ребер: ребра целиком за
+//    плоскостью отбрасываются, пересекающие - обрезаются по ней (точка
+//    пересечения добавляется в конец массива вершин)
+// 5. Ключ кэша: буферы координат и ребер, число вершин, итоговая матрица, размер
+// 6. Сжатый mesh (mesh_codec.h): вершины раскодируются кусками прямо перед
+//    ядром проекции, ребра не раскодируются целиком - GetEdgeStream()
+//    отдает их блоками (после обрезки по ближней плоскости - обычный список)
+//
+// Без зависимостей от Qt. Все в namespace s21
+
+#ifndef PROJECTION_H_
+#define PROJECTION_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "../model/model.h"  // Mesh, TransformMatrix, Mat4
+
+namespace s21 {
+
+struct ScreenVertex {
+    float x, y;    // Пиксели
+    float depth;   // Меньше - ближе
+};
+
+// Ближняя плоскость: вершины с меньшим w не проецируются (для Camera -
+// расстояние от наблюдателя до ближней плоскости)
+constexpr double kNearClipW = 0.01;
+
+struct ScreenRect {
+    float min_x, min_y;
+    float max_x, max_y;
+};
+
+enum class BoxProjection {
+    kProjected,   // Все углы перед наблюдателем, прямоугольник определен
+    kBehind,      // Все углы за ближней плоскостью (w < kNearClipW) - не виден
+    kCrossing     // Пересекает плоскость наблюдателя, прямоугольник не определен
+};
+
+// Область вывода width x height: [-1, 1] по короткой стороне, ось Y вниз
+Mat4 ViewportMatrix(int width, int height);
+
+// Проекция итоговой матрицей (ViewportMatrix * матрица модели)
+class PointProjector {
+public:
+    explicit PointProjector(const Mat4& combined);
+
+    ScreenVertex operator()(double x, double y, double z) const {
+        const Mat4& m = matrix_;
+        double sx = m(0, 0) * x + m(0, 1) * y + m(0, 2) * z + m(0, 3);
+        double sy = m(1, 0) * x + m(1, 1) * y + m(1, 2) * z + m(1, 3);
+        double sz = m(2, 0) * x + m(2, 1) * y + m(2, 2) * z + m(2, 3);
+        if (affine_) return ScreenVertex{float(sx), float(sy), float(-sz)};
+        // Центральная проекция: (viewport * clip) / w == viewport * (clip / w)
+        double w = m(3, 0) * x + m(3, 1) * y + m(3, 2) * z + m(3, 3);
+        return ScreenVertex{float(sx / w), float(sy / w), float(sz / w)};
+    }
+
+    bool IsAffine() const { return affine_; }
+
+    // Ребро, обрезанное по ближней плоскости; false - ребро целиком за ней
+    bool ProjectEdge(const Vec3& from, const Vec3& to, ScreenVertex& a, ScreenVertex& b) const;
+
+    // Экранный прямоугольник 8 углов параллелепипеда
+    BoxProjection ProjectBox(const float min[3], const float max[3], ScreenRect& rect) const;
+
+private:
+    Mat4 matrix_;
+    bool affine_;   // Нижняя строка (0, 0, 0, 1)
+};
+
+class ProjectionCache {
+public:
+    // Пересчитывает кэш, если изменились mesh, матрица или размер; true - пересчитан
+    bool Update(const Mesh& mesh, const TransformMatrix& matrix, int width, int height);
+    void Invalidate() { valid_ = false; }  // Mesh изменился на месте (тот же буфер)
+
+    // Вершины mesh'а (за ближней плоскостью - NaN), затем точки обрезки ребер
+    const std::vector<ScreenVertex>& GetVertices() const { return vertices_; }
+    // Только вершины mesh'а - для отрисовки точек
+    std::span<const ScreenVertex> GetMeshVertices() const { return {vertices_.data(), count_}; }
+    // Ребра для отрисовки (индексы в GetVertices()): ребра mesh'а или обрезанный список
+    std::span<const uint32_t> GetEdges() const { return edges_; }
+    // Не nullptr - ребра сжатого mesh'а (GetEdges() пуст), читать блоками
+    const EdgeStream* GetEdgeStream() const { return edge_stream_; }
+    size_t GetClippedCount() const { return clipped_count_; }  // Вершин за ближней плоскостью
+
+private:
+    std::vector<ScreenVertex> vertices_;
+    std::vector<uint8_t> behind_;          // 1 - вершина за ближней плоскостью
+    std::vector<uint32_t> clipped_edges_;
+    std::span<const uint32_t> edges_;
+    const EdgeStream* edge_stream_ = nullptr;
+    size_t clipped_count_ = 0;
+    bool valid_ = false;
+    const void* source_ = nullptr;         // Ключ: буферы координат и ребер, число вершин,
+    const uint32_t* edge_source_ = nullptr; // матрица и размер области вывода
+    size_t count_ = 0;
+    size_t edge_count_ = 0;
+    Mat4 matrix_;
+    int width_ = 0;
+    int height_ = 0;
+
+    void clipEdges(const Mesh& mesh);
+    void clipBlock(const PointProjector& project, const Mesh& mesh, std::span<const uint32_t> edges);
+};
+
+}  // namespace s21
+
+#endif  // PROJECTION_H_
@@ -0,0 +1,249 @@
+// RENDER_PIPELINE.CPP - Реализация отрисовки кадров в отдельном потоке
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - FrameRenderer: кадр из снимка Model (черновой mesh, основной mesh,
+//   объекты сцены), уровни LOD и бюджет ребер по времени прошлых кадров;
+//   защелка проверки отмены, общая для всех стратегий кадра
+// - RenderPipeline: очередь из одного запроса (condition_variable),
+//   прерывание устаревшего кадра, обмен переднего и заднего буферов,
+//   свой пул потоков кадра (не ждет загрузку на ThreadPool::Shared())
+
+#include "render_pipeline.h"
+
+#include <QElapsedTimer>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <utility>
+
+#include "../model/profiler.h"  // Profiler, S21_PROFILE_SCOPE
+#include "../model/scene.h"     // Scene, SceneObject
+
+namespace s21 {
+
+// ====== FrameRenderer ======
+
+FrameRenderer::FrameRenderer(ThreadPool& pool)
+    : solid_drawer_(pool), point_drawer_(pool), scene_point_drawer_(pool) {}
+
+bool FrameRenderer::Render(QPainter& painter, const FrameRequest& request,
+                           const AbandonCheck& abandoned) {
+    std::atomic<bool> dropped{false};
+    const AbandonCheck latched = [&] {
+        if (dropped.load(std::memory_order_relaxed)) return true;
+        if (!abandoned || !abandoned()) return false;
+        dropped.store(true, std::memory_order_relaxed);
+        return true;
+    };
+    setAbandonCheck(&latched);
+    bool complete = renderFrame(painter, request, latched);
+    setAbandonCheck(nullptr);  // latched живет только до конца Render
+    return complete && !dropped.load(std::memory_order_relaxed);
+}
+
+void FrameRenderer::setAbandonCheck(const AbandonCheck* check) {
+    drawer_.SetAbandonCheck(check);
+    scene_drawer_.SetAbandonCheck(check);
+    solid_drawer_.SetAbandonCheck(check);
+    point_drawer_.SetAbandonCheck(check);
+    scene_point_drawer_.SetAbandonCheck(check);
+}
+
+bool FrameRenderer::renderFrame(QPainter& painter, const FrameRequest& request,
+                                const AbandonCheck& abandoned) {
+    painter.fillRect(0, 0, request.width, request.height, request.background);
+    const Camera& camera = request.camera;
+
+    // Черновой mesh уже нормализован и рисуется без матрицы модели
+    if (request.preview) {
+        TransformMatrix viewProjection(camera.GetViewProjection());
+        if (request.preview->IsPointCloud()) {
+            drawPoints(point_drawer_, painter, request, *request.preview, viewProjection, edge_budget_);
+        } else {
+            drawer_.DrawMesh(painter, *request.preview, viewProjection, request.settings);
+        }
+        return true;
+    }
+
+    const ModelSnapshot& model = request.model;
+    if (!model.mesh) return true;
+    QElapsedTimer frame;
+    frame.start();
+    const Scene* scene = model.scene.get();
+    const bool hasMesh = model.mesh->GetVertexCount() > 0;
+    size_t parts = (scene ? scene->GetObjectCount() : 0) + (hasMesh ? 1 : 0);
+    size_t budget = edge_budget_ / std::max<size_t>(parts, 1);
+    size_t edges = 0;
+    if (hasMesh) {
+        // Одна матрица на кадр, вершины проецируются одним проходом
+        TransformMatrix mvp = camera.GetModelViewProjection(model.model_matrix);
+        const Mesh& full = *model.mesh;
+        if (full.IsPointCloud()) {
+            edges += drawPoints(point_drawer_, painter, request, full, mvp, budget);
+        } else {
+            const Mesh& mesh = request.solid  // У уровней LOD нет граней
+                                   ? full
+                                   : selectMesh(full, model.accelerators.lods.get(), budget,
+                                                request.interacting);
+            if (request.solid) {
+                solid_drawer_.DrawMesh(painter, mesh, mvp, request.settings);
+            } else {
+                drawer_.SetEdgeGrid(model.accelerators.edge_grid.get());  // Для уровня LOD не применяется
+                drawer_.DrawMesh(painter, mesh, mvp, request.settings);
+            }
+            edges += mesh.GetEdgeCount();
+        }
+        if (abandoned()) return false;
+    }
+
+    if (scene) {
+        for (const SceneObject& object : scene->GetObjects()) {
+            if (abandoned()) return false;
+            const SceneGeometry& geometry = *object.geometry;
+            TransformMatrix mvp = camera.GetModelViewProjection(model.model_matrix.Multiply(object.transform));
+            if (geometry.mesh.IsPointCloud()) {
+                edges += drawPoints(scene_point_drawer_, painter, request, geometry.mesh, mvp, budget);
+                continue;
+            }
+            const Mesh& mesh = selectMesh(geometry.mesh, geometry.accelerators.lods.get(), budget,
+                                          request.interacting);
+            scene_drawer_.SetEdgeGrid(geometry.accelerators.edge_grid.get());
+            scene_drawer_.DrawMesh(painter, mesh, mvp, request.settings);
+            edges += mesh.GetEdgeCount();
+        }
+    }
+    if (abandoned()) return false;  // Время неполного кадра не годится для бюджета
+    updateEdgeBudget(edges, frame.nsecsElapsed() / 1e6);
+    return true;
+}
+
+void FrameRenderer::InvalidateCaches() {
+    drawer_.InvalidateCache();
+    scene_drawer_.InvalidateCache();
+    solid_drawer_.InvalidateCache();
+    point_drawer_.InvalidateCache();
+    scene_point_drawer_.InvalidateCache();
+}
+
+size_t FrameRenderer::drawPoints(PointCloudStrategy& drawer, QPainter& painter,
+                                 const FrameRequest& request, const Mesh& mesh,
+                                 const TransformMatrix& matrix, size_t budget) {
+    drawer.SetPointBudget(request.interacting ? budget : 0);
+    drawer.DrawMesh(painter, mesh, matrix, request.settings);
+    return drawer.GetDrawnCount();
+}
+
+const Mesh& FrameRenderer::selectMesh(const Mesh& full, const MeshLodChain* lods, size_t budget,
+                                      bool interacting) const {
+    if (!interacting || !lods) return full;
+    const Mesh* level = lods->Select(budget);
+    return level ? *level : full;
+}
+
+void FrameRenderer::updateEdgeBudget(size_t edges, double milliseconds) {
+    if (edges == 0 || milliseconds <= 0.0) return;
+    double affordable = edges * kFrameBudgetMs / milliseconds;
+    double budget = std::sqrt(affordable * double(edge_budget_));
+    edge_budget_ = static_cast<size_t>(std::max(budget, double(MeshLodChain::kCoarsestEdges)));
+}
+
+// ====== RenderPipeline ======
+
+RenderPipeline::RenderPipeline(FrameReadyHandler onFrameReady)
+    : on_frame_ready_(std::move(onFrameReady)), renderer_(pool_) {
+    thread_ = std::thread(&RenderPipeline::run, this);
+}
+
+RenderPipeline::~RenderPipeline() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    thread_.join();
+}
+
+uint64_t RenderPipeline::Submit(FrameRequest request) {
+    uint64_t version;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        version = ++next_version_;
+        request.version = version;
+        // Замещенный запрос не должен потерять сброс кэшей
+        if (pending_ && pending_->invalidate_caches) request.invalidate_caches = true;
+        pending_ = std::move(request);
+        latest_version_.store(version, std::memory_order_release);
+    }
+    wake_.notify_one();
+    return version;
+}
+
+bool RenderPipeline::PaintFront(QPainter& painter, const QColor& background) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (front_.isNull()) return false;
+    painter.drawImage(0, 0, front_);
+    const int width = painter.device()->width(), height = painter.device()->height();
+    if (front_.width() < width) {
+        painter.fillRect(front_.width(), 0, width - front_.width(), height, background);
+    }
+    if (front_.height() < height) {
+        painter.fillRect(0, front_.height(), front_.width(), height - front_.height(), background);
+    }
+    return true;
+}
+
+uint64_t RenderPipeline::GetFrontVersion() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return front_version_;
+}
+
+// Есть запрос новее, а показанный кадр еще свежий (иначе кадр дорисовывается)
+bool RenderPipeline::isSuperseded(uint64_t version) const {
+    if (latest_version_.load(std::memory_order_acquire) == version) return false;
+    return front_shown_ != Clock::time_point{} &&
+           Clock::now() - front_shown_ < std::chrono::milliseconds(kMaxStaleMs);
+}
+
+void RenderPipeline::run() {
+    ThreadPool::SetCurrent(&pool_);  // Проекция и отсечение кадра - тоже на pool_
+    for (;;) {
+        FrameRequest request;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [this] { return stopping_ || pending_.has_value(); });
+            if (stopping_) return;
+            request = std::move(*pending_);
+            pending_.reset();
+        }
+        if (request.invalidate_caches) renderer_.InvalidateCaches();
+        if (request.width <= 0 || request.height <= 0) continue;
+
+        const uint64_t start = Profiler::NowNs();
+        if (back_.width() != request.width || back_.height() != request.height) {
+            back_ = QImage(request.width, request.height, QImage::Format_ARGB32_Premultiplied);
+        }
+        bool complete;
+        {
+            QPainter painter(&back_);
+            complete = renderer_.Render(painter, request,
+                                        [&] { return isSuperseded(request.version); });
+        }
+        Profiler::Instance().Record(complete ? "frame" : "frame: dropped", ProfileCategory::kFrame, start,
+                                    Profiler::NowNs() - start);
+        if (!complete) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        // Готовый кадр показывается, даже если пришел запрос новее: он ближе
+        // к текущему состоянию, чем front_
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::swap(front_, back_);
+            front_version_ = request.version;
+        }
+        front_shown_ = Clock::now();
+        if (on_frame_ready_) on_frame_ready_();
+    }
+}
+
+}  // namespace s21
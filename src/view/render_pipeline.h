@@ -0,0 +1,167 @@
+// RENDER_PIPELINE.H - Отрисовка кадров в отдельном потоке с двойной буферизацией
+//
+// ЗАЧЕМ НУЖЕН:
+// Раньше ModelWidget::paintEvent сам проецировал и растеризовал модель в
+// GUI потоке: тяжелый кадр (большая модель, залитые грани) замораживал
+// окно, а ввод мышью ждал конца кадра. Здесь кадр рисуется в рабочем
+// потоке в задний буфер, paintEvent только выводит последний готовый
+// передний буфер - GUI отвечает, сколько бы ни длился кадр.
+//
+// ЧТО СОДЕРЖИТ:
+// - FrameRequest - все, что нужно для кадра: снимок Model (ModelSnapshot),
+//   черновой mesh, камера, настройки, размер; ссылок на виджет и Model нет
+// - FrameRenderer класс - стратегии отрисовки, выбор уровня LOD и бюджет
+//   ребер кадра (то, что раньше делал ModelWidget)
+// - RenderPipeline класс - поток отрисовки, очередь из одного кадра,
+//   передний и задний буферы
+//
+// КАК РАБОТАЕТ:
+// 1. Submit() (GUI поток): запрос получает номер версии и замещает еще не
+//    начатый кадр - в очереди всегда только самое новое состояние
+// 2. Поток отрисовки берет запрос, рисует его через FrameRenderer в
+//    back_ (QImage, QPainter в рабочем потоке допустим для QImage)
+// 3. Устаревший кадр бросается: проверка (пришел ли запрос новее)
+//    передается стратегиям отрисовки (SceneDrawerBase::SetAbandonCheck) -
+//    они спрашивают ее между пачками линий, блоками точек и плитками
+//    растеризатора; FrameRenderer - после основного mesh'а и перед каждым
+//    объектом сцены. Если запрос новее есть и показанный кадр моложе
+//    kMaxStaleMs - кадр прерывается ("frame: dropped"), поток сразу берет
+//    новый запрос. Показанный кадр старше - текущий дорисовывается: при
+//    кадрах дольше интервала ввода иначе не был бы показан ни один.
+//    Ответ проверки защелкивается на весь кадр: она зависит от времени и
+//    после отказа одной стратегии могла бы разрешить остальные
+// 4. Готовый кадр: front_ и back_ меняются местами под мьютексом (копии
+//    нет), вызывается on_frame_ready (из потока отрисовки - виджет
+//    переносит его в GUI поток)
+// 5. PaintFront() (GUI поток) выводит front_ под тем же мьютексом; часть
+//    окна вне кадра (размер изменился, новый кадр еще рисуется) заливается
+//    фоном
+// 6. Стратегии и их кэши (проекция, буферы растеризатора) принадлежат
+//    потоку отрисовки; сброс кэшей передается флагом в запросе
+// 7. У потока отрисовки свой ThreadPool (pool_, ThreadPool::SetCurrent):
+//    общий пул во время фоновой загрузки занят разбором, и кадр без своего
+//    пула рисовался бы в одном потоке
+//
+// Все в namespace s21
+
+#ifndef RENDER_PIPELINE_H_
+#define RENDER_PIPELINE_H_
+
+#include <QColor>
+#include <QImage>
+#include <QPainter>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "../model/mesh_lod.h"  // MeshLodChain
+#include "../model/model.h"     // ModelSnapshot, Mesh
+#include "../model/parallel.h"  // ThreadPool
+#include "camera.h"             // Camera
+#include "rendering.h"          // QtSceneDrawer, SolidStrategy, PointCloudStrategy, DrawSettings
+
+namespace s21 {
+
+struct FrameRequest {
+    ModelSnapshot model;
+    std::shared_ptr<const Mesh> preview;  // Черновой mesh во время загрузки (рисуется вместо model)
+    Camera camera;
+    DrawSettings settings;
+    QColor background = Qt::black;
+    int width = 0;
+    int height = 0;
+    bool solid = false;                   // Основной mesh - SolidStrategy
+    bool interacting = false;             // Идет ввод: уровни LOD и бюджет точек
+    bool invalidate_caches = false;       // Сбросить кэши стратегий перед кадром
+    uint64_t version = 0;                 // Присваивает RenderPipeline::Submit
+};
+
+class FrameRenderer {
+public:
+    static constexpr double kFrameBudgetMs = 16.0;  // 60 fps во время ввода
+    static constexpr size_t kInitialEdgeBudget = 1u << 20;
+
+    // pool - для растеризатора и точек; остальное идет через ParallelFor()
+    explicit FrameRenderer(ThreadPool& pool = ThreadPool::Shared());
+
+    // abandoned: true - кадр нужно прервать (вызывается и из потоков пула).
+    // false - кадр прерван, painter содержит незаконченное изображение
+    bool Render(QPainter& painter, const FrameRequest& request, const AbandonCheck& abandoned);
+    void InvalidateCaches();
+    size_t GetEdgeBudget() const { return edge_budget_; }
+
+private:
+    QtSceneDrawer drawer_;                 // Хранит кэш проекции между кадрами
+    QtSceneDrawer scene_drawer_;           // Объекты сцены
+    SolidStrategy solid_drawer_;           // Основной mesh при FrameRequest::solid
+    PointCloudStrategy point_drawer_;      // Облако точек: основной и черновой mesh
+    PointCloudStrategy scene_point_drawer_;
+    size_t edge_budget_ = kInitialEdgeBudget;
+
+    // Части кадра; abandoned - защелкнутая проверка из Render()
+    bool renderFrame(QPainter& painter, const FrameRequest& request, const AbandonCheck& abandoned);
+    void setAbandonCheck(const AbandonCheck* check);
+    // Полный mesh или уровень LOD под budget (вне ввода - всегда полный)
+    const Mesh& selectMesh(const Mesh& full, const MeshLodChain* lods, size_t budget,
+                           bool interacting) const;
+    // Возвращает число нарисованных точек (вне ввода budget не действует)
+    size_t drawPoints(PointCloudStrategy& drawer, QPainter& painter, const FrameRequest& request,
+                      const Mesh& mesh, const TransformMatrix& matrix, size_t budget);
+    void updateEdgeBudget(size_t edges, double milliseconds);
+};
+
+class RenderPipeline {
+public:
+    static constexpr int kMaxStaleMs = 100;  // Показанный кадр старше - новый не прерывается
+
+    // Вызывается в потоке отрисовки после каждого показанного кадра
+    using FrameReadyHandler = std::function<void()>;
+
+    explicit RenderPipeline(FrameReadyHandler onFrameReady);
+    ~RenderPipeline();  // Дожидается текущего кадра
+
+    RenderPipeline(const RenderPipeline&) = delete;
+    RenderPipeline& operator=(const RenderPipeline&) = delete;
+
+    // Замещает еще не начатый запрос; возвращает номер версии кадра
+    uint64_t Submit(FrameRequest request);
+    // Последний готовый кадр в painter (GUI поток); false - кадров еще не было
+    bool PaintFront(QPainter& painter, const QColor& background) const;
+    uint64_t GetFrontVersion() const;
+    size_t GetDroppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    FrameReadyHandler on_frame_ready_;
+    ThreadPool pool_;                      // ThreadPool::Current() потока отрисовки
+    FrameRenderer renderer_;               // Только в потоке отрисовки
+    QImage back_;                          // Только в потоке отрисовки
+    Clock::time_point front_shown_{};      // Пишется в потоке отрисовки между кадрами
+
+    mutable std::mutex mutex_;             // pending_, stopping_, front_
+    std::condition_variable wake_;
+    std::optional<FrameRequest> pending_;
+    bool stopping_ = false;
+    uint64_t next_version_ = 0;
+    QImage front_;
+    uint64_t front_version_ = 0;
+
+    std::atomic<uint64_t> latest_version_{0};  // Номер последнего Submit
+    std::atomic<size_t> dropped_{0};
+    std::thread thread_;                   // Последним: запускается после остальных полей
+
+    void run();
+    bool isSuperseded(uint64_t version) const;
+};
+
+}  // namespace s21
+
+#endif  // RENDER_PIPELINE_H_
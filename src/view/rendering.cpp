@@ -13,6 +13,10 @@
 // - Оптимизация отрисовки для больших моделей
 // - Интеграция с Qt (QPainter, QPen, QBrush)
 // - Простая 3D проекция: ортогональная проекция 3D координат в 2D экранные
+// - QtSceneDrawer::drawCulled() - отсечение ячеек EdgeGrid по области вывода
+// - SoftwareSceneDrawer::DrawMesh() - кадр из SoftwareRasterizer -> drawImage
+// - SolidStrategy::DrawMesh() - залитые грани, плоское освещение от наблюдателя
+// - PointCloudStrategy::DrawMesh() - облако точек через PointSplatter
 //
 // КАК РАБОТАЕТ:
 // 1. Инициализация отрисовки:
@@ -20,23 +24,487 @@
 //    - Настройка QPen и QBrush для линий и точек
 //    - Инициализация параметров проекции
 // 2. Отрисовка сцены:
-//    - Проекция 3D координат в 2D экранные координаты
-//    - Отрисовка линий между вершинами (QPainter::drawLine)
-//    - Отрисовка вершин как точек (QPainter::drawPoint)
+//    - Проекция 3D координат в 2D экранные координаты (ProjectionCache,
+//      projection.cpp)
+//    - Отрисовка линий между вершинами пачками (QPainter::drawLines)
+//    - Отрисовка вершин как точек (QPainter::drawPoints)
 // 3. Настройки отображения:
 //    - Цвета через QPen::setColor и QBrush::setColor
 //    - Толщина линий через QPen::setWidth
 //    - Размер вершин через QPen::setWidth
 //
 // ОПТИМИЗАЦИЯ:
-// - Кэширование спроецированных координат
-// - Отрисовка только видимых частей модели
+// - Кэширование спроецированных координат (до смены mesh'а/матрицы/размера)
+// - Отрисовка только видимых частей модели (ячейки EdgeGrid вне кадра не проецируются)
 // - Упрощенная геометрия для больших моделей
 // - Асинхронная обработка событий
-// - Батчевая отрисовка линий
+// - Батчевая отрисовка линий (kLineBatch линий на вызов, массив без реаллокаций)
+//
+// ПРОФИЛИРОВАНИЕ (profiler.h, категория kFrame):
+// - "draw: project" - ProjectionCache::Update (пусто, если кэш действителен)
+// - "draw: cull" - выбор ячеек EdgeGrid, "draw: culled lines" - их ребра
+// - "draw: lines", "draw: vertices" - вызовы QPainter
+// - SoftwareSceneDrawer: "draw: project", "draw: rasterize", "draw: present"
+// - SolidStrategy: "draw: project", "draw: shade" (цвета граней),
+//   "draw: rasterize", "draw: present"
+// - PointCloudStrategy: "draw: splat", "draw: resolve", "draw: present"
 //
 // ПРИНЦИПЫ MVC:
 // - НИКАКОЙ бизнес-логики, только визуализация
 // - Получает данные модели от Controller
 // - Отображает модель без изменения данных
 // - Инкапсулирует всю логику Qt отрисовки
+
+#include "rendering.h"
+
+#include <QImage>
+#include <QPen>
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "../model/profiler.h"  // S21_PROFILE_SCOPE
+
+namespace s21 {
+
+namespace {
+
+constexpr size_t kPointBatch = 1u << 14;     // Точек в одном вызове drawPoints
+
+// QColor -> пиксель QImage::Format_ARGB32_Premultiplied
+uint32_t premultipliedPixel(const QColor& color) {
+    uint32_t a = uint32_t(color.alpha());
+    uint32_t r = uint32_t(color.red()) * a / 255;
+    uint32_t g = uint32_t(color.green()) * a / 255;
+    uint32_t b = uint32_t(color.blue()) * a / 255;
+    return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+// Однородная точка, которую m переводит в x = y = w = 0: ядро строк 0, 1, 3
+// (обобщенное векторное произведение - дополнения по столбцам).
+// Для матрицы камеры это наблюдатель; w = 0 - направление на бесконечность
+std::array<double, 4> viewerPoint(const Mat4& m) {
+    const int rows[3] = {0, 1, 3};
+    auto minor = [&](int skip) {
+        int c[3], k = 0;
+        for (int col = 0; col < 4; ++col) {
+            if (col != skip) c[k++] = col;
+        }
+        auto at = [&](int r, int i) { return m(rows[r], c[i]); };
+        return at(0, 0) * (at(1, 1) * at(2, 2) - at(1, 2) * at(2, 1)) -
+               at(0, 1) * (at(1, 0) * at(2, 2) - at(1, 2) * at(2, 0)) +
+               at(0, 2) * (at(1, 0) * at(2, 1) - at(1, 1) * at(2, 0));
+    };
+    return {-minor(0), minor(1), -minor(2), minor(3)};
+}
+
+// Ребра проекции: сжатые (EdgeStream) раскодируются при раскладке
+void rasterizeEdges(SoftwareRasterizer& rasterizer, const ProjectionCache& projection, uint32_t color) {
+    if (const EdgeStream* stream = projection.GetEdgeStream()) {
+        rasterizer.DrawLines(projection.GetVertices(), *stream, color);
+    } else {
+        rasterizer.DrawLines(projection.GetVertices(), projection.GetEdges(), color);
+    }
+}
+
+}  // namespace
+
+// ====== QtSceneDrawer ======
+
+QtSceneDrawer::QtSceneDrawer() : lines_(kLineBatch), points_(kPointBatch) {}
+
+void QtSceneDrawer::DrawMesh(QPainter& painter, const Mesh& mesh, const TransformMatrix& matrix,
+                             const DrawSettings& settings) {
+    if (mesh.GetVertexCount() == 0) return;
+    if (grid_ && grid_->IsBuiltFor(mesh) && drawCulled(painter, mesh, matrix, settings)) return;
+    {
+        S21_PROFILE_SCOPE("draw: project", kFrame);
+        projection_.Update(mesh, matrix, painter.device()->width(), painter.device()->height());
+    }
+
+    drawEdges(painter, settings);
+    if (settings.vertex_size > 0.0 && !abandoned()) drawVertices(painter, settings);
+}
+
+void QtSceneDrawer::drawEdges(QPainter& painter, const DrawSettings& settings) {
+    S21_PROFILE_SCOPE("draw: lines", kFrame);
+    QPen pen(settings.line_color);
+    pen.setWidthF(settings.line_width);
+    painter.setPen(pen);
+
+    const ScreenVertex* vertices = projection_.GetVertices().data();
+    auto drawBatches = [&](std::span<const uint32_t> edges) {
+        size_t edgeCount = edges.size() / 2;
+        for (size_t first = 0; first < edgeCount; first += kLineBatch) {
+            if (abandoned()) return;
+            size_t count = std::min(kLineBatch, edgeCount - first);
+            const uint32_t* pair = edges.data() + first * 2;
+            for (size_t i = 0; i < count; ++i, pair += 2) {
+                const ScreenVertex& a = vertices[pair[0]];
+                const ScreenVertex& b = vertices[pair[1]];
+                lines_[i] = QLineF(a.x, a.y, b.x, b.y);
+            }
+            painter.drawLines(lines_.data(), static_cast<int>(count));
+        }
+    };
+
+    const EdgeStream* stream = projection_.GetEdgeStream();
+    if (!stream) {
+        drawBatches(projection_.GetEdges());  // С обрезкой по ближней плоскости
+        return;
+    }
+    // Сжатые ребра: блоки раскодируются пачками по kLineBatch ребер
+    static_assert(kLineBatch % EdgeStream::kBlockEdges == 0);
+    edge_batch_.resize(kLineBatch * 2);
+    const size_t blocks = stream->GetBlockCount();
+    for (size_t first = 0; first < blocks; first += kLineBatch / EdgeStream::kBlockEdges) {
+        if (abandoned()) return;
+        size_t last = std::min(blocks, first + kLineBatch / EdgeStream::kBlockEdges), count = 0;
+        for (size_t block = first; block < last; ++block) {
+            count += stream->DecodeBlock(block, edge_batch_.data() + count * 2);
+        }
+        drawBatches({edge_batch_.data(), count * 2});
+    }
+}
+
+void QtSceneDrawer::drawVertices(QPainter& painter, const DrawSettings& settings) {
+    S21_PROFILE_SCOPE("draw: vertices", kFrame);
+    QPen pen(settings.vertex_color);
+    pen.setWidthF(settings.vertex_size);
+    pen.setCapStyle(settings.round_vertices ? Qt::RoundCap : Qt::SquareCap);
+    painter.setPen(pen);
+
+    std::span<const ScreenVertex> vertices = projection_.GetMeshVertices();
+    const bool skipHidden = projection_.GetClippedCount() > 0;  // NaN за ближней плоскостью
+    for (size_t first = 0; first < vertices.size(); first += kPointBatch) {
+        if (abandoned()) return;
+        size_t end = std::min(vertices.size(), first + kPointBatch);
+        size_t count = 0;
+        for (size_t i = first; i < end; ++i) {
+            if (skipHidden && std::isnan(vertices[i].x)) continue;
+            points_[count++] = QPointF(vertices[i].x, vertices[i].y);
+        }
+        painter.drawPoints(points_.data(), static_cast<int>(count));
+    }
+}
+
+bool QtSceneDrawer::drawCulled(QPainter& painter, const Mesh& mesh, const TransformMatrix& matrix,
+                               const DrawSettings& settings) {
+    const int width = painter.device()->width(), height = painter.device()->height();
+    const PointProjector project(ViewportMatrix(width, height) * matrix.GetMat4());
+    std::span<const EdgeGridCell> cells = grid_->GetCells();
+    // Толстые линии и вершины выступают за границы ячейки
+    const float margin = float(std::max(settings.line_width, settings.vertex_size) * 0.5 + 1.0);
+
+    // 1. Ячейки в области вывода; ячейка меньше пикселя - точка
+    visible_cells_.clear();
+    crossing_cells_.clear();
+    collapsed_cells_.clear();
+    size_t visibleEdges = 0;
+    ProfileAccumulator cullTime("draw: cull", ProfileCategory::kFrame);
+    cullTime.Begin();
+    for (size_t c = 0; c < cells.size(); ++c) {
+        const EdgeGridCell& cell = cells[c];
+        ScreenRect rect;
+        BoxProjection side = project.ProjectBox(cell.min, cell.max, rect);
+        if (side == BoxProjection::kBehind) continue;
+        visibleEdges += cell.count;
+        if (side == BoxProjection::kCrossing) {
+            // Пересекает ближнюю плоскость: ребра обрезаются по одному
+            crossing_cells_.push_back(uint32_t(c));
+            continue;
+        }
+        if (rect.max_x < -margin || rect.min_x > width + margin ||
+            rect.max_y < -margin || rect.min_y > height + margin) {
+            visibleEdges -= cell.count;
+            continue;
+        }
+        if (rect.max_x - rect.min_x < kCollapsePixels && rect.max_y - rect.min_y < kCollapsePixels) {
+            visibleEdges -= cell.count;
+            collapsed_cells_.emplace_back((rect.min_x + rect.max_x) * 0.5, (rect.min_y + rect.max_y) * 0.5);
+            continue;
+        }
+        visible_cells_.push_back(uint32_t(c));
+    }
+    cullTime.End();
+    if (visibleEdges + collapsed_cells_.size() > mesh.GetEdgeCount() * kCullRatio) return false;
+    S21_PROFILE_SCOPE("draw: culled lines", kFrame);
+
+    QPen linePen(settings.line_color);
+    linePen.setWidthF(settings.line_width);
+    QPen vertexPen(settings.vertex_color);
+    vertexPen.setWidthF(settings.vertex_size);
+    vertexPen.setCapStyle(settings.round_vertices ? Qt::RoundCap : Qt::SquareCap);
+    painter.setPen(linePen);
+    for (size_t first = 0; first < collapsed_cells_.size(); first += kPointBatch) {
+        size_t count = std::min(kPointBatch, collapsed_cells_.size() - first);
+        painter.drawPoints(collapsed_cells_.data() + first, static_cast<int>(count));
+    }
+
+    // 2. Ребра видимых ячеек: группы ячеек до kCullChunk ребер, проекция параллельно
+    std::span<const uint32_t> ids = grid_->GetEdgeIds();
+    std::span<const uint32_t> edges = mesh.GetEdgeIndices();
+    std::span<const float> x = mesh.GetX(), y = mesh.GetY(), z = mesh.GetZ();
+    for (size_t begin = 0; begin < visible_cells_.size();) {
+        if (abandoned()) return true;  // Отсечение выбрано - полный кадр не нужен
+        size_t end = begin, total = 0;
+        group_offsets_.clear();
+        while (end < visible_cells_.size() &&
+               (end == begin || total + cells[visible_cells_[end]].count <= kCullChunk)) {
+            group_offsets_.push_back(total);
+            total += cells[visible_cells_[end++]].count;
+        }
+        if (culled_lines_.size() < total) culled_lines_.resize(std::max(total, kCullChunk));
+
+        ParallelFor(end - begin, [&](size_t i) {
+            const EdgeGridCell& cell = cells[visible_cells_[begin + i]];
+            QLineF* out = culled_lines_.data() + group_offsets_[i];
+            for (uint32_t k = 0; k < cell.count; ++k) {
+                const uint32_t* pair = edges.data() + size_t(ids[cell.first + k]) * 2;
+                ScreenVertex a = project(x[pair[0]], y[pair[0]], z[pair[0]]);
+                ScreenVertex b = project(x[pair[1]], y[pair[1]], z[pair[1]]);
+                out[k] = QLineF(a.x, a.y, b.x, b.y);
+            }
+        });
+
+        for (size_t first = 0; first < total; first += kLineBatch) {
+            size_t count = std::min(kLineBatch, total - first);
+            painter.drawLines(culled_lines_.data() + first, static_cast<int>(count));
+        }
+        if (settings.vertex_size > 0.0) {
+            painter.setPen(vertexPen);
+            drawLineEnds(painter, culled_lines_.data(), total);
+            painter.setPen(linePen);
+        }
+        begin = end;
+    }
+
+    // 3. Ячейки на ближней плоскости: ребра с обрезкой, последовательно
+    size_t count = 0;
+    auto flush = [&]() {
+        painter.drawLines(lines_.data(), static_cast<int>(count));
+        if (settings.vertex_size > 0.0) {
+            painter.setPen(vertexPen);
+            drawLineEnds(painter, lines_.data(), count);
+            painter.setPen(linePen);
+        }
+        count = 0;
+    };
+    for (uint32_t index : crossing_cells_) {
+        if (abandoned()) return true;
+        const EdgeGridCell& cell = cells[index];
+        for (uint32_t k = 0; k < cell.count; ++k) {
+            const uint32_t* pair = edges.data() + size_t(ids[cell.first + k]) * 2;
+            ScreenVertex a, b;
+            if (!project.ProjectEdge(Vec3{x[pair[0]], y[pair[0]], z[pair[0]]},
+                                     Vec3{x[pair[1]], y[pair[1]], z[pair[1]]}, a, b)) {
+                continue;
+            }
+            lines_[count++] = QLineF(a.x, a.y, b.x, b.y);
+            if (count == kLineBatch) flush();
+        }
+    }
+    if (count > 0) flush();
+    return true;
+}
+
+// Вершины видимых ребер (вершина нескольких ребер рисуется несколько раз)
+void QtSceneDrawer::drawLineEnds(QPainter& painter, const QLineF* lines, size_t count) {
+    const size_t perBatch = kPointBatch / 2;
+    for (size_t first = 0; first < count; first += perBatch) {
+        size_t batch = std::min(perBatch, count - first);
+        for (size_t i = 0; i < batch; ++i) {
+            points_[i * 2] = lines[first + i].p1();
+            points_[i * 2 + 1] = lines[first + i].p2();
+        }
+        painter.drawPoints(points_.data(), static_cast<int>(batch * 2));
+    }
+}
+
+// ====== SoftwareSceneDrawer ======
+
+SoftwareSceneDrawer::SoftwareSceneDrawer(ThreadPool& pool) : rasterizer_(pool) {}
+
+void SoftwareSceneDrawer::DrawMesh(QPainter& painter, const Mesh& mesh,
+                                   const TransformMatrix& matrix, const DrawSettings& settings) {
+    if (mesh.GetVertexCount() == 0) return;
+    int width = painter.device()->width(), height = painter.device()->height();
+    {
+        S21_PROFILE_SCOPE("draw: project", kFrame);
+        projection_.Update(mesh, matrix, width, height);
+    }
+
+    {
+        S21_PROFILE_SCOPE("draw: rasterize", kFrame);
+        rasterizer_.SetAbandonCheck(abandon_);
+        rasterizer_.Resize(width, height);
+        rasterizer_.Clear(0);  // Прозрачный фон: поверх остается фон виджета
+        rasterizeEdges(rasterizer_, projection_, premultipliedPixel(settings.line_color));
+        if (settings.vertex_size > 0.0) {
+            int size = std::max(1, int(std::lround(settings.vertex_size)));
+            rasterizer_.DrawPoints(projection_.GetMeshVertices(), size,
+                                   premultipliedPixel(settings.vertex_color));
+        }
+    }
+    if (abandoned()) return;  // Буфер недорисован
+
+    // QImage ссылается на буфер растеризатора, копии нет
+    S21_PROFILE_SCOPE("draw: present", kFrame);
+    QImage frame(reinterpret_cast<const uchar*>(rasterizer_.GetPixels()), width, height,
+                 width * int(sizeof(uint32_t)), QImage::Format_ARGB32_Premultiplied);
+    painter.drawImage(0, 0, frame);
+}
+
+// ====== SolidStrategy ======
+
+SolidStrategy::SolidStrategy(ThreadPool& pool) : rasterizer_(pool) {}
+
+void SolidStrategy::DrawMesh(QPainter& painter, const Mesh& mesh, const TransformMatrix& matrix,
+                             const DrawSettings& settings) {
+    if (mesh.GetVertexCount() == 0) return;
+    int width = painter.device()->width(), height = painter.device()->height();
+    bool projected;
+    {
+        S21_PROFILE_SCOPE("draw: project", kFrame);
+        projected = projection_.Update(mesh, matrix, width, height);
+    }
+
+    uint32_t faceColor = premultipliedPixel(settings.face_color);
+    if (mesh.HasFaces() && (projected || faceColor != shaded_color_ ||
+                            face_colors_.size() != mesh.GetTriangleCount())) {
+        S21_PROFILE_SCOPE("draw: shade", kFrame);
+        shadeFaces(mesh, matrix, faceColor);
+    }
+    if (abandoned()) return;
+
+    {
+        S21_PROFILE_SCOPE("draw: rasterize", kFrame);
+        rasterizer_.SetAbandonCheck(abandon_);
+        rasterizer_.Resize(width, height);
+        rasterizer_.Clear(0);  // Прозрачный фон: поверх остается фон виджета
+        if (mesh.HasFaces()) {
+            rasterizer_.DrawTriangles(projection_.GetMeshVertices(), mesh.GetTriangles(), face_colors_,
+                                      cull_back_faces_);
+        } else {
+            rasterizeEdges(rasterizer_, projection_, premultipliedPixel(settings.line_color));
+        }
+        if (settings.vertex_size > 0.0) {
+            int size = std::max(1, int(std::lround(settings.vertex_size)));
+            rasterizer_.DrawPoints(projection_.GetMeshVertices(), size,
+                                   premultipliedPixel(settings.vertex_color));
+        }
+    }
+    if (abandoned()) return;
+
+    S21_PROFILE_SCOPE("draw: present", kFrame);
+    QImage frame(reinterpret_cast<const uchar*>(rasterizer_.GetPixels()), width, height,
+                 width * int(sizeof(uint32_t)), QImage::Format_ARGB32_Premultiplied);
+    painter.drawImage(0, 0, frame);
+}
+
+// Цвет грани: |cos| угла между нормалью и направлением на наблюдателя
+// (модуль - грань видна с обеих сторон, если отсечение выключено)
+void SolidStrategy::shadeFaces(const Mesh& mesh, const TransformMatrix& matrix, uint32_t color) {
+    std::span<const uint32_t> triangles = mesh.GetTriangles();
+    std::span<const float> normals = mesh.GetFaceNormals();
+    const size_t count = triangles.size() / 3;
+    face_colors_.resize(count);
+    shaded_color_ = color;
+
+    const Mat4& m = matrix.GetMat4();
+    std::array<double, 4> viewer = viewerPoint(m);
+    const bool atInfinity = std::abs(viewer[3]) < 1e-12;
+    if (atInfinity) {
+        // Направление к наблюдателю - в сторону уменьшения глубины (projection.h)
+        double towards = m(2, 0) * viewer[0] + m(2, 1) * viewer[1] + m(2, 2) * viewer[2];
+        double length = std::sqrt(viewer[0] * viewer[0] + viewer[1] * viewer[1] + viewer[2] * viewer[2]);
+        double sign = towards < 0.0 ? -1.0 : 1.0;
+        for (int i = 0; i < 3; ++i) viewer[i] = length > 0.0 ? sign * viewer[i] / length : 0.0;
+    } else {
+        for (int i = 0; i < 3; ++i) viewer[i] /= viewer[3];
+    }
+    const float eye[3] = {float(viewer[0]), float(viewer[1]), float(viewer[2])};
+
+    // Premultiplied: каналы цвета масштабируются, альфа остается
+    const uint32_t alpha = color & 0xff000000u;
+    const float channel[3] = {float((color >> 16) & 0xff), float((color >> 8) & 0xff),
+                              float(color & 0xff)};
+    ParallelFor((count + kShadeBlock - 1) / kShadeBlock, [&](size_t block) {
+        size_t end = std::min(count, (block + 1) * kShadeBlock);
+        for (size_t t = block * kShadeBlock; t < end; ++t) {
+            float lx = eye[0], ly = eye[1], lz = eye[2];
+            if (!atInfinity) {
+                const uint32_t* corner = triangles.data() + t * 3;
+                float a[3], b[3], c[3];  // Вершины - через ReadPosition (сжатый Mesh)
+                mesh.ReadPosition(corner[0], a);
+                mesh.ReadPosition(corner[1], b);
+                mesh.ReadPosition(corner[2], c);
+                lx -= (a[0] + b[0] + c[0]) * (1.0f / 3.0f);
+                ly -= (a[1] + b[1] + c[1]) * (1.0f / 3.0f);
+                lz -= (a[2] + b[2] + c[2]) * (1.0f / 3.0f);
+                float length = std::sqrt(lx * lx + ly * ly + lz * lz);
+                float inverse = length > 0.0f ? 1.0f / length : 0.0f;
+                lx *= inverse, ly *= inverse, lz *= inverse;
+            }
+            float cosine = std::abs(normals[t * 3] * lx + normals[t * 3 + 1] * ly + normals[t * 3 + 2] * lz);
+            float intensity = kAmbient + (1.0f - kAmbient) * std::min(cosine, 1.0f);
+            uint32_t r = uint32_t(channel[0] * intensity + 0.5f);
+            uint32_t g = uint32_t(channel[1] * intensity + 0.5f);
+            uint32_t b = uint32_t(channel[2] * intensity + 0.5f);
+            face_colors_[t] = alpha | (r << 16) | (g << 8) | b;
+        }
+    });
+}
+
+// ====== PointCloudStrategy ======
+
+PointCloudStrategy::PointCloudStrategy(ThreadPool& pool) : splatter_(pool) {}
+
+void PointCloudStrategy::DrawMesh(QPainter& painter, const Mesh& mesh, const TransformMatrix& matrix,
+                                  const DrawSettings& settings) {
+    const size_t count = mesh.GetVertexCount();
+    if (count == 0) return;
+    int width = painter.device()->width(), height = painter.device()->height();
+
+    PointSplatOptions options = options_;
+    options.size = std::max(1, int(std::lround(settings.vertex_size)));
+    options.stride = budget_ > 0 && count > budget_ ? (count + budget_ - 1) / budget_ : 1;
+    // Из stride точек рисуется одна - порог плотности уменьшается так же
+    options.min_density = uint32_t(std::max<size_t>(1, options_.min_density / options.stride));
+    Mat4 combined = ViewportMatrix(width, height) * matrix.GetMat4();
+    uint32_t color = premultipliedPixel(settings.vertex_color);
+
+    // Тот же кадр (перерисовка окна без изменений) - без проекции
+    bool same = valid_ && source_ == mesh.GetStorageKey() && count_ == count && matrix_ == combined &&
+                splatter_.GetWidth() == width && splatter_.GetHeight() == height && color_ == color &&
+                drawn_options_ == options;
+    if (!same) {
+        {
+            S21_PROFILE_SCOPE("draw: splat", kFrame);
+            splatter_.SetAbandonCheck(abandon_);
+            splatter_.Resize(width, height);
+            drawn_ = splatter_.Splat(mesh, combined, options);
+        }
+        if (abandoned()) {
+            valid_ = false;  // Буфер глубины неполный - следующий кадр проецирует заново
+            return;
+        }
+        {
+            S21_PROFILE_SCOPE("draw: resolve", kFrame);
+            splatter_.Resolve(color, options);
+        }
+        valid_ = true;
+        source_ = mesh.GetStorageKey();
+        count_ = count;
+        matrix_ = combined;
+        color_ = color;
+        drawn_options_ = options;
+    }
+
+    S21_PROFILE_SCOPE("draw: present", kFrame);
+    QImage frame(reinterpret_cast<const uchar*>(splatter_.GetPixels()), width, height,
+                 width * int(sizeof(uint32_t)), QImage::Format_ARGB32_Premultiplied);
+    painter.drawImage(0, 0, frame);
+}
+
+}  // namespace s21
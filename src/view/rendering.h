@@ -8,23 +8,61 @@
 // ЧТО СОДЕРЖИТ:
 // - SceneDrawerBase абстрактный класс (интерфейс для отрисовки) - паттерн Strategy
 // - QtSceneDrawer класс (конкретная реализация для Qt) - Qt рендеринг
+// - SoftwareSceneDrawer класс - многопоточный программный растеризатор
+//   (SoftwareRasterizer), готовый кадр выводится через QPainter::drawImage
+// - SolidStrategy класс - залитые грани с плоским освещением (буфер
+//   глубины, отсечение нелицевых граней, плитки на всех ядрах)
+// - PointCloudStrategy класс - облако точек (Mesh::IsPointCloud) проекцией
+//   прямо в буфер глубины (PointSplatter), без кэша проекции
 // - Методы для отрисовки Scene, Mesh, Vertex, Edge
 // - Настройки отрисовки (цвета, толщина линий, размер вершин)
 // - Поддержка разных типов проекции (параллельная/центральная)
 // - Простая 3D проекция: ортогональная проекция 3D координат в 2D экранные
 // - Оптимизация рендеринга для больших моделей
-// - Стратегии рендеринга: WireframeStrategy, SolidStrategy, PointCloudStrategy
+// - Стратегии рендеринга: каркас (QtSceneDrawer, SoftwareSceneDrawer),
+//   грани (SolidStrategy), точки (PointCloudStrategy)
 //
 // КАК РАБОТАЕТ:
 // 1. SceneDrawerBase::DrawScene() - абстрактный метод отрисовки сцены
 // 2. QtSceneDrawer::DrawScene() - конкретная реализация через QPainter
 // 3. Отрисовка каркасной модели:
 //    - Создание QPainter для отрисовки
-//    - Проекция 3D координат в 2D экранные координаты
-//    - Отрисовка линий между вершинами (QPainter::drawLine)
+//    - Проекция 3D координат в 2D экранные координаты: каждая вершина
+//      проецируется один раз в ProjectionCache (projection.h);
+//      кэш пересчитывается только при смене mesh'а, матрицы или размера виджета
+//    - Отрисовка линий пачками: пары точек из кэша копируются в заранее
+//      выделенный массив QLineF (kLineBatch) -> QPainter::drawLines
 // 4. Отрисовка вершин:
-//    - Отрисовка вершин как точек (QPainter::drawPoint)
-// 5. Настройки отображения:
+//    - Точки кэша пачками через QPainter::drawPoints
+// 5. SoftwareSceneDrawer: та же проекция, затем SoftwareRasterizer рисует
+//    линии и точки по плиткам на всех ядрах, буфер оборачивается в QImage
+//    без копирования
+// 5a. SolidStrategy: та же проекция, треугольники граней mesh'а
+//    (Mesh::GetTriangles) заливаются SoftwareRasterizer::DrawTriangles.
+//    Цвет грани - ламбертово освещение от источника у наблюдателя:
+//    face_color * (kAmbient + (1 - kAmbient) * |cos|), cos - угол между
+//    нормалью грани и направлением на наблюдателя. Наблюдатель находится
+//    в координатах mesh'а без обращения матрицы: MVP переводит его в
+//    x = y = w = 0, то есть это ядро строк 0, 1, 3 матрицы (обобщенное
+//    векторное произведение); при параллельной проекции ядро - направление
+//    (w = 0). Цвета граней пересчитываются только вместе с проекцией или
+//    при смене face_color. Mesh без граней рисуется каркасом
+// 5b. PointCloudStrategy: точки не проецируются в ProjectionCache (12 байт
+//    на точку), PointSplatter пишет их сразу в буфер глубины экрана -
+//    память кадра не зависит от числа точек. Во время ввода рисуется
+//    каждая k-я точка (SetPointBudget), готовый кадр повторяется без
+//    проекции, пока не изменились mesh, матрица, размер или настройки
+// 6. Отсечение (QtSceneDrawer с EdgeGrid большой модели): углы ячеек
+//    проецируются и сравниваются с областью вывода, ребра видимых ячеек
+//    проецируются в каждом кадре заново (параллельно, без кэша), ячейка
+//    меньше kCollapsePixels рисуется одной точкой цвета линий. Если видна
+//    большая часть ребер (kCullRatio) - обычный кадр с кэшем проекции
+// 6a. Отмена кадра (SetAbandonCheck): QtSceneDrawer проверяет ее между
+//    пачками линий, точек и группами ячеек; растеризатор и PointSplatter -
+//    в каждом блоке и плитке. Отмененный кадр не выводится (drawImage
+//    пропускается) и не запоминается как готовый (PointCloudStrategy);
+//    кэш проекции остается верным - проекция не прерывается
+// 7. Настройки отображения:
 //    - Цвета через QPen и QBrush
 //    - Толщина линий через QPen::setWidth
 //    - Размер вершин через QPen::setWidth
@@ -36,29 +74,182 @@
 // - Инкапсулирует всю логику визуализации
 //
 // Все в namespace s21
-// В rendering.h уже есть SceneDrawerBase - это хорошая основа!
-// Можно добавить разные стратегии:
 
-class RenderingStrategy {
+#ifndef RENDERING_H_
+#define RENDERING_H_
+
+#include <QColor>
+#include <QLineF>
+#include <QPainter>
+#include <QPointF>
+#include <cstdint>
+#include <vector>
+
+#include "../model/edge_grid.h"       // EdgeGrid
+#include "../model/model.h"           // Mesh, TransformMatrix
+#include "../model/parallel.h"        // ThreadPool
+#include "point_splatter.h"           // PointSplatter
+#include "projection.h"               // ProjectionCache, PointProjector, ScreenVertex
+#include "software_rasterizer.h"      // SoftwareRasterizer
+
+namespace s21 {
+
+// Настройки отображения
+struct DrawSettings {
+    QColor line_color = Qt::white;
+    QColor vertex_color = Qt::red;
+    double line_width = 1.0;
+    double vertex_size = 0.0;   // 0 - вершины не рисуются
+    bool round_vertices = false;
+    QColor face_color = QColor(200, 200, 200);   // SolidStrategy: цвет освещенной грани
+};
+
+// Интерфейс отрисовки (Strategy)
+class SceneDrawerBase {
+public:
+    virtual ~SceneDrawerBase() = default;
+
+    // matrix: MVP (Camera::GetModelViewProjection) - локальные координаты mesh'а ->
+    // clip-пространство, после деления на w [-1, 1] по короткой стороне виджета
+    virtual void DrawMesh(QPainter& painter, const Mesh& mesh, const TransformMatrix& matrix,
+                          const DrawSettings& settings) = 0;
+
+    // nullptr - кадр рисуется до конца; проверка должна жить, пока идет DrawMesh
+    void SetAbandonCheck(const AbandonCheck* check) { abandon_ = check; }
+
+protected:
+    const AbandonCheck* abandon_ = nullptr;   // Передается растеризатору стратегии
+
+    bool abandoned() const { return abandon_ && (*abandon_)(); }
+};
+
+// Отрисовка через QPainter: кэш проекции + пакетные drawLines/drawPoints.
+// С индексом ребер (EdgeGrid) рисуются только ячейки в области вывода,
+// ячейка меньше пикселя - одной точкой
+class QtSceneDrawer : public SceneDrawerBase {
+public:
+    static constexpr size_t kLineBatch = 1u << 14;  // Линий в одном вызове drawLines
+    static constexpr float kCollapsePixels = 1.0f;  // Ячейка уже и ниже - одна точка
+    // Видна большая доля ребер - выгоднее полный кадр с кэшем проекции
+    static constexpr double kCullRatio = 0.5;
+    static constexpr size_t kCullChunk = 1u << 16;  // Ребер в одной параллельной проекции
+
+    QtSceneDrawer();
+
+    void DrawMesh(QPainter& painter, const Mesh& mesh, const TransformMatrix& matrix,
+                  const DrawSettings& settings) override;
+    void InvalidateCache() { projection_.Invalidate(); }
+
+    // Индекс ребер mesh'а (nullptr - без отсечения); используется только
+    // для mesh'а, для которого построен (EdgeGrid::IsBuiltFor)
+    void SetEdgeGrid(const EdgeGrid* grid) { grid_ = grid; }
+
+private:
+    ProjectionCache projection_;
+    std::vector<QLineF> lines_;    // Выделяются один раз (kLineBatch)
+    std::vector<uint32_t> edge_batch_;  // Раскодированные ребра сжатого mesh'а (kLineBatch)
+    std::vector<QPointF> points_;
+    const EdgeGrid* grid_ = nullptr;
+    std::vector<uint32_t> visible_cells_;    // Номера ячеек grid_ в текущем кадре
+    std::vector<uint32_t> crossing_cells_;   // Пересекают ближнюю плоскость
+    std::vector<QPointF> collapsed_cells_;
+    std::vector<size_t> group_offsets_;
+    std::vector<QLineF> culled_lines_;
+
+    void drawEdges(QPainter& painter, const DrawSettings& settings);
+    void drawVertices(QPainter& painter, const DrawSettings& settings);
+    // false - отсечение невыгодно (видна большая часть модели), ничего не нарисовано
+    bool drawCulled(QPainter& painter, const Mesh& mesh, const TransformMatrix& matrix,
+                    const DrawSettings& settings);
+    void drawLineEnds(QPainter& painter, const QLineF* lines, size_t count);
+};
+
+// Отрисовка собственным многопоточным растеризатором: кадр собирается в буфере
+// SoftwareRasterizer и выводится одним QPainter::drawImage.
+// Линии всегда толщиной 1 пиксель (line_width не учитывается), вершины - квадраты
+class SoftwareSceneDrawer : public SceneDrawerBase {
 public:
-    virtual ~RenderingStrategy() = default;
-    virtual void Render(const Scene& scene, QPainter& painter) = 0;
+    explicit SoftwareSceneDrawer(ThreadPool& pool = ThreadPool::Shared());
+
+    void DrawMesh(QPainter& painter, const Mesh& mesh, const TransformMatrix& matrix,
+                  const DrawSettings& settings) override;
+    void InvalidateCache() { projection_.Invalidate(); }
+
+    // Скрытые линии: ближние ребра закрывают дальние (буфер глубины)
+    void SetDepthTest(bool enabled) { rasterizer_.SetDepthTest(enabled); }
+    const SoftwareRasterizer& GetRasterizer() const { return rasterizer_; }
+
+private:
+    ProjectionCache projection_;
+    SoftwareRasterizer rasterizer_;
 };
 
-class WireframeStrategy : public RenderingStrategy {
-    void Render(const Scene& scene, QPainter& painter) override {
-        // Отрисовка только линий (каркас)
-    }
+// Залитые грани с плоским освещением (по грани - один цвет): кадр собирается
+// в SoftwareRasterizer с буфером глубины и выводится одним drawImage.
+// Освещение считается в координатах mesh'а - при неравномерном масштабе
+// матрицы модели яркость приблизительна. Вершины (vertex_size) - поверх граней
+class SolidStrategy : public SceneDrawerBase {
+public:
+    static constexpr float kAmbient = 0.2f;   // Доля яркости грани, повернутой ребром
+    static constexpr size_t kShadeBlock = 1u << 16;  // Граней в одной параллельной задаче
+
+    explicit SolidStrategy(ThreadPool& pool = ThreadPool::Shared());
+
+    void DrawMesh(QPainter& painter, const Mesh& mesh, const TransformMatrix& matrix,
+                  const DrawSettings& settings) override;
+    void InvalidateCache() { projection_.Invalidate(); }
+
+    // Нелицевые грани не рисуются (замкнутые модели); выключить для открытых поверхностей
+    void SetBackFaceCulling(bool enabled) { cull_back_faces_ = enabled; }
+    bool IsBackFaceCullingEnabled() const { return cull_back_faces_; }
+    const SoftwareRasterizer& GetRasterizer() const { return rasterizer_; }
+
+private:
+    ProjectionCache projection_;
+    SoftwareRasterizer rasterizer_;
+    std::vector<uint32_t> face_colors_;   // Пиксель на грань, до смены проекции
+    uint32_t shaded_color_ = 0;           // face_color, с которым посчитаны face_colors_
+    bool cull_back_faces_ = true;
+
+    void shadeFaces(const Mesh& mesh, const TransformMatrix& matrix, uint32_t color);
 };
 
-class SolidStrategy : public RenderingStrategy {
-    void Render(const Scene& scene, QPainter& painter) override {
-        // Отрисовка залитых граней
-    }
+// Облако точек: проекция прямо в буфер глубины, пиксель - ближайшая точка.
+// Цвет - vertex_color, размер точки - vertex_size (не меньше 1 пикселя);
+// ребра mesh'а не рисуются. Порог плотности и заполнение дыр - PointSplatter
+class PointCloudStrategy : public SceneDrawerBase {
+public:
+    explicit PointCloudStrategy(ThreadPool& pool = ThreadPool::Shared());
+
+    void DrawMesh(QPainter& painter, const Mesh& mesh, const TransformMatrix& matrix,
+                  const DrawSettings& settings) override;
+    void InvalidateCache() { valid_ = false; }
+
+    // Не больше points точек на кадр (каждая k-я); 0 - все точки
+    void SetPointBudget(size_t points) { budget_ = points; }
+    // Пиксель рисуется, если в него попало не меньше points точек (1 - любой);
+    // при бюджете порог делится на шаг прореживания
+    void SetMinDensity(uint32_t points) { options_.min_density = std::max(points, 1u); }
+    uint32_t GetMinDensity() const { return options_.min_density; }
+    void SetHoleFilling(bool enabled) { options_.fill_holes = enabled; }
+    size_t GetDrawnCount() const { return drawn_; }   // Точек в последнем кадре
+    const PointSplatter& GetSplatter() const { return splatter_; }
+
+private:
+    PointSplatter splatter_;
+    PointSplatOptions options_;
+    size_t budget_ = 0;
+    size_t drawn_ = 0;
+
+    // Ключ готового кадра
+    bool valid_ = false;
+    const void* source_ = nullptr;
+    size_t count_ = 0;
+    Mat4 matrix_;
+    uint32_t color_ = 0;
+    PointSplatOptions drawn_options_;
 };
 
-class PointCloudStrategy : public RenderingStrategy {
-    void Render(const Scene& scene, QPainter& painter) override {
-        // Отрисовка только вершин
-    }
-};
\ No newline at end of file
+}  // namespace s21
+
+#endif  // RENDERING_H_
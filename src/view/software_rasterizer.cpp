@@ -0,0 +1,429 @@
+// SOFTWARE_RASTERIZER.CPP - Реализация программного растеризатора
+//
+// ЧТО РЕАЛИЗУЕТ:
+// - Отсечение отрезка по экрану (Лианг-Барски, во float) и округление концов
+// - Точное разложение отрезка по плиткам: для каждого столбца (строки) плиток
+//   вдоль главной оси - диапазон строк (столбцов), через которые он проходит
+// - Раскладку сжатых ребер (EdgeStream): задача подготовки раскодирует
+//   свои блоки на стеке, порядок отрезков тот же, что у массива ребер
+// - Брезенхэм с произвольной начальной точкой:
+//   y(x) = y0 + sign * floor((2 * (x - x0) * |dy| + |dx|) / (2 * |dx|))
+//   (тот же пиксель, что дает классический пошаговый алгоритм)
+// - Тест глубины с линейной интерполяцией глубины вдоль главной оси
+// - Треугольники: знак удвоенной площади (отсечение нелицевых), плоскость
+//   глубины, развертка по строкам с пересечениями ребер, посчитанными от
+//   верхнего конца ребра (одинаково в обоих треугольниках общего ребра)
+//
+// Блоки подготовки и плитки раздаются через ThreadPool::ParallelFor;
+// буферы плиток сохраняют память между кадрами. Отмененная задача
+// (isAbandoned) выходит сразу, не трогая свои буферы.
+
+#include "software_rasterizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace s21 {
+
+namespace {
+
+constexpr size_t kBlockPrimitives = 1u << 14;   // Примитивов в блоке подготовки
+
+// Отсечение параметров t отрезка p + t * d по полосе [lo, hi]
+bool clipAxis(float p, float d, float lo, float hi, float& t0, float& t1) {
+    if (d == 0.0f) return p >= lo && p <= hi;
+    float a = (lo - p) / d;
+    float b = (hi - p) / d;
+    if (a > b) std::swap(a, b);
+    t0 = std::max(t0, a);
+    t1 = std::min(t1, b);
+    return t0 <= t1;
+}
+
+// Первый пиксель с центром не левее (не выше) v, в пределах [lo, hi + 1]
+inline int ceilPixel(float v, int lo, int hi) {
+    return int(std::clamp(std::ceil(v), float(lo), float(hi + 1)));
+}
+
+// Пиксель второстепенной оси для пиксельной координаты главной оси
+inline int minorAt(int major, int major0, int minor0, int64_t twiceMinorDelta,
+                   int64_t majorDelta, int sign) {
+    if (majorDelta == 0) return minor0;
+    int64_t steps = (int64_t(major - major0) * twiceMinorDelta + majorDelta) / (2 * majorDelta);
+    return minor0 + sign * int(steps);
+}
+
+}  // namespace
+
+SoftwareRasterizer::SoftwareRasterizer(ThreadPool& pool) : pool_(pool) {}
+
+void SoftwareRasterizer::Resize(int width, int height) {
+    width = std::max(width, 0);
+    height = std::max(height, 0);
+    if (width == width_ && height == height_) return;
+    width_ = width;
+    height_ = height;
+    tiles_x_ = (width + kTileSize - 1) / kTileSize;
+    tiles_y_ = (height + kTileSize - 1) / kTileSize;
+    color_.assign(size_t(width) * height, 0);
+    depth_.assign(size_t(width) * height, std::numeric_limits<float>::infinity());
+    segment_bins_.clear();
+    point_bins_.clear();
+    triangle_bins_.clear();
+}
+
+void SoftwareRasterizer::Clear(uint32_t color) {
+    const float far = std::numeric_limits<float>::infinity();
+    pool_.ParallelFor(size_t(tiles_y_), [&](size_t row) {
+        size_t begin = row * kTileSize * size_t(width_);
+        size_t end = std::min(color_.size(), begin + kTileSize * size_t(width_));
+        std::fill(color_.begin() + begin, color_.begin() + end, color);
+        std::fill(depth_.begin() + begin, depth_.begin() + end, far);
+    });
+}
+
+template <typename T>
+size_t SoftwareRasterizer::prepareBins(std::vector<std::vector<T>>& bins,
+                                       size_t primitiveCount) const {
+    size_t wanted = (primitiveCount + kBlockPrimitives - 1) / kBlockPrimitives;
+    size_t blocks = std::clamp<size_t>(wanted, 1, size_t(pool_.GetThreadCount()) * 4);
+    size_t needed = blocks * getTileCount();
+    if (bins.size() < needed) bins.resize(needed);
+    for (size_t i = 0; i < needed; ++i) bins[i].clear();
+    return blocks;
+}
+
+bool SoftwareRasterizer::setupSegment(const ScreenVertex& a, const ScreenVertex& b,
+                                      Segment& segment) const {
+    if (!std::isfinite(a.x) || !std::isfinite(a.y) || !std::isfinite(b.x) || !std::isfinite(b.y)) {
+        return false;
+    }
+    // Центры пикселей - целые координаты; экран = [-0.5, size - 0.5)
+    float dx = b.x - a.x, dy = b.y - a.y;
+    float t0 = 0.0f, t1 = 1.0f;
+    auto inside = [&](const ScreenVertex& v) {
+        return v.x >= -0.5f && v.x <= width_ - 0.5f && v.y >= -0.5f && v.y <= height_ - 0.5f;
+    };
+    if (!inside(a) || !inside(b)) {
+        if (!clipAxis(a.x, dx, -0.5f, width_ - 0.5f, t0, t1)) return false;
+        if (!clipAxis(a.y, dy, -0.5f, height_ - 0.5f, t0, t1)) return false;
+    }
+
+    // После отсечения v >= -0.5: отбрасывание дробной части от v + 0.5 - округление
+    auto toPixel = [](float v, int size) { return std::clamp(int(v + 0.5f), 0, size - 1); };
+    int x0 = toPixel(a.x + t0 * dx, width_), y0 = toPixel(a.y + t0 * dy, height_);
+    int x1 = toPixel(a.x + t1 * dx, width_), y1 = toPixel(a.y + t1 * dy, height_);
+    float z0 = a.depth + t0 * (b.depth - a.depth);
+    float z1 = a.depth + t1 * (b.depth - a.depth);
+
+    // Нормализация направления: результат не зависит от порядка концов ребра
+    bool xMajor = std::abs(x1 - x0) >= std::abs(y1 - y0);
+    if (xMajor) {
+        segment = x0 <= x1 ? Segment{x0, y0, x1, y1, z0, z1, true}
+                           : Segment{x1, y1, x0, y0, z1, z0, true};
+    } else {
+        segment = y0 <= y1 ? Segment{y0, x0, y1, x1, z0, z1, false}
+                           : Segment{y1, x1, y0, x0, z1, z0, false};
+    }
+    return true;
+}
+
+void SoftwareRasterizer::binSegment(const Segment& s, std::vector<Segment>* bins) const {
+    auto tileOf = [&](int major, int minor) {
+        int band = major / kTileSize, cross = minor / kTileSize;
+        return s.x_major ? cross * tiles_x_ + band : band * tiles_x_ + cross;
+    };
+    // Короткие отрезки (большинство в плотной модели) - в одной плитке
+    if (s.major0 / kTileSize == s.major1 / kTileSize && s.minor0 / kTileSize == s.minor1 / kTileSize) {
+        bins[tileOf(s.major0, s.minor0)].push_back(s);
+        return;
+    }
+
+    // Полоса плиток вдоль главной оси -> диапазон второстепенной оси в ней
+    int64_t majorDelta = s.major1 - s.major0;
+    int64_t twiceMinorDelta = 2 * int64_t(std::abs(s.minor1 - s.minor0));
+    int sign = s.minor1 >= s.minor0 ? 1 : -1;
+    for (int band = s.major0 / kTileSize; band <= s.major1 / kTileSize; ++band) {
+        int from = std::max(s.major0, band * kTileSize);
+        int to = std::min(s.major1, band * kTileSize + kTileSize - 1);
+        int a = minorAt(from, s.major0, s.minor0, twiceMinorDelta, majorDelta, sign);
+        int b = minorAt(to, s.major0, s.minor0, twiceMinorDelta, majorDelta, sign);
+        for (int cross = std::min(a, b) / kTileSize; cross <= std::max(a, b) / kTileSize; ++cross) {
+            bins[tileOf(band * kTileSize, cross * kTileSize)].push_back(s);
+        }
+    }
+}
+
+SoftwareRasterizer::TileRect SoftwareRasterizer::getTileRect(size_t tile) const {
+    int x0 = int(tile % tiles_x_) * kTileSize, y0 = int(tile / tiles_x_) * kTileSize;
+    return TileRect{x0, y0, std::min(x0 + kTileSize, width_) - 1,
+                    std::min(y0 + kTileSize, height_) - 1};
+}
+
+inline void SoftwareRasterizer::plot(int x, int y, float depth, uint32_t color) {
+    size_t pixel = size_t(y) * width_ + x;
+    if (depth_test_) {
+        if (!(depth < depth_[pixel])) return;
+        depth_[pixel] = depth;
+    }
+    color_[pixel] = color;
+}
+
+void SoftwareRasterizer::rasterSegment(const Segment& s, const TileRect& rect, uint32_t color) {
+    int majorLo = s.x_major ? rect.x0 : rect.y0, majorHi = s.x_major ? rect.x1 : rect.y1;
+    int minorLo = s.x_major ? rect.y0 : rect.x0, minorHi = s.x_major ? rect.y1 : rect.x1;
+    int first = std::max(s.major0, majorLo), last = std::min(s.major1, majorHi);
+    if (first > last) return;
+
+    int64_t majorDelta = s.major1 - s.major0;
+    int64_t twiceMajorDelta = 2 * majorDelta;
+    int64_t twiceMinorDelta = 2 * int64_t(std::abs(s.minor1 - s.minor0));
+    int sign = s.minor1 >= s.minor0 ? 1 : -1;
+    float depthStep = majorDelta ? (s.z1 - s.z0) / float(majorDelta) : 0.0f;
+
+    // Точка входа в плитку - по формуле (деление нужно, только если отрезок
+    // начался в другой плитке), дальше - шаги Брезенхэма с остатком error
+    int minor = s.minor0;
+    int64_t error = majorDelta;
+    if (first != s.major0) {
+        int64_t numerator = int64_t(first - s.major0) * twiceMinorDelta + majorDelta;
+        minor += sign * int(numerator / twiceMajorDelta);
+        error = numerator % twiceMajorDelta;
+    }
+    for (int major = first; major <= last; ++major) {
+        if (minor >= minorLo && minor <= minorHi) {
+            float depth = s.z0 + depthStep * float(major - s.major0);
+            if (s.x_major) {
+                plot(major, minor, depth, color);
+            } else {
+                plot(minor, major, depth, color);
+            }
+        }
+        error += twiceMinorDelta;
+        if (error >= twiceMajorDelta) {
+            error -= twiceMajorDelta;
+            minor += sign;
+        }
+    }
+}
+
+void SoftwareRasterizer::DrawLines(std::span<const ScreenVertex> vertices,
+                                   std::span<const uint32_t> edges, uint32_t color) {
+    size_t edgeCount = edges.size() / 2;
+    if (edgeCount == 0 || getTileCount() == 0) return;
+    size_t blocks = prepareBins(segment_bins_, edgeCount);
+    size_t perBlock = (edgeCount + blocks - 1) / blocks;
+    size_t tileCount = getTileCount();
+
+    // 1. Отсечение и разложение по плиткам (блоки идут по порядку ребер)
+    pool_.ParallelFor(blocks, [&](size_t block) {
+        if (isAbandoned()) return;
+        std::vector<Segment>* bins = segment_bins_.data() + block * tileCount;
+        size_t end = std::min(edgeCount, (block + 1) * perBlock);
+        Segment segment;
+        for (size_t e = block * perBlock; e < end; ++e) {
+            if (setupSegment(vertices[edges[e * 2]], vertices[edges[e * 2 + 1]], segment)) {
+                binSegment(segment, bins);
+            }
+        }
+    });
+
+    rasterSegmentBins(blocks, color);
+}
+
+void SoftwareRasterizer::DrawLines(std::span<const ScreenVertex> vertices, const EdgeStream& edges,
+                                   uint32_t color) {
+    const size_t streamBlocks = edges.GetBlockCount();
+    if (streamBlocks == 0 || getTileCount() == 0) return;
+    size_t blocks = prepareBins(segment_bins_, edges.GetEdgeCount());
+    size_t perBlock = (streamBlocks + blocks - 1) / blocks;  // Блоков EdgeStream на задачу
+    size_t tileCount = getTileCount();
+
+    pool_.ParallelFor(blocks, [&](size_t block) {
+        if (isAbandoned()) return;
+        std::vector<Segment>* bins = segment_bins_.data() + block * tileCount;
+        uint32_t pairs[EdgeStream::kBlockEdges * 2];
+        size_t end = std::min(streamBlocks, (block + 1) * perBlock);
+        Segment segment;
+        for (size_t source = block * perBlock; source < end; ++source) {
+            size_t count = edges.DecodeBlock(source, pairs);
+            for (size_t e = 0; e < count; ++e) {
+                if (setupSegment(vertices[pairs[e * 2]], vertices[pairs[e * 2 + 1]], segment)) {
+                    binSegment(segment, bins);
+                }
+            }
+        }
+    });
+    rasterSegmentBins(blocks, color);
+}
+
+// 2. Плитки независимы: каждая рисует свои отрезки в порядке номеров
+void SoftwareRasterizer::rasterSegmentBins(size_t blocks, uint32_t color) {
+    const size_t tileCount = getTileCount();
+    pool_.ParallelFor(tileCount, [&](size_t tile) {
+        if (isAbandoned()) return;
+        TileRect rect = getTileRect(tile);
+        for (size_t block = 0; block < blocks; ++block) {
+            for (const Segment& segment : segment_bins_[block * tileCount + tile]) {
+                rasterSegment(segment, rect, color);
+            }
+        }
+    });
+}
+
+void SoftwareRasterizer::rasterPoint(const ScreenVertex& v, int size, const TileRect& rect,
+                                     uint32_t color) {
+    int left = int(std::lround(v.x)) - size / 2, top = int(std::lround(v.y)) - size / 2;
+    int x0 = std::max(left, rect.x0), x1 = std::min(left + size - 1, rect.x1);
+    int y0 = std::max(top, rect.y0), y1 = std::min(top + size - 1, rect.y1);
+    for (int y = y0; y <= y1; ++y) {
+        for (int x = x0; x <= x1; ++x) plot(x, y, v.depth, color);
+    }
+}
+
+bool SoftwareRasterizer::setupTriangle(const ScreenVertex& a, const ScreenVertex& b,
+                                       const ScreenVertex& c, bool cullBackFaces,
+                                       Triangle& t) const {
+    float ux = b.x - a.x, uy = b.y - a.y, vx = c.x - a.x, vy = c.y - a.y;
+    float area = ux * vy - uy * vx;  // Удвоенная; NaN (ближняя плоскость) не проходит проверку
+    if (!(area < 0.0f || (area > 0.0f && !cullBackFaces)) || !std::isfinite(area)) return false;
+
+    t.min_x = ceilPixel(std::min({a.x, b.x, c.x}), 0, width_ - 1);
+    t.max_x = ceilPixel(std::max({a.x, b.x, c.x}), 0, width_ - 1) - 1;
+    t.min_y = ceilPixel(std::min({a.y, b.y, c.y}), 0, height_ - 1);
+    t.max_y = ceilPixel(std::max({a.y, b.y, c.y}), 0, height_ - 1) - 1;
+    if (t.min_x > t.max_x || t.min_y > t.max_y) return false;  // Вне экрана или между центрами
+
+    t.x[0] = a.x, t.x[1] = b.x, t.x[2] = c.x;
+    t.y[0] = a.y, t.y[1] = b.y, t.y[2] = c.y;
+    float du = b.depth - a.depth, dv = c.depth - a.depth;
+    t.z0 = a.depth;
+    t.dzdx = (du * vy - dv * uy) / area;
+    t.dzdy = (dv * ux - du * vx) / area;
+    return true;
+}
+
+void SoftwareRasterizer::rasterTriangle(const Triangle& t, const TileRect& rect) {
+    int firstRow = std::max(t.min_y, rect.y0), lastRow = std::min(t.max_y, rect.y1);
+    int firstColumn = std::max(t.min_x, rect.x0), lastColumn = std::min(t.max_x, rect.x1);
+    if (firstRow > lastRow || firstColumn > lastColumn) return;
+
+    // Ребра от верхнего конца: x(y) = top_x + (y - top_y) * slope на [top_y, bottom_y)
+    float topX[3], topY[3], bottomY[3], slope[3];
+    int edgeCount = 0;
+    for (int i = 0; i < 3; ++i) {
+        int j = (i + 1) % 3, top = t.y[i] < t.y[j] ? i : j, bottom = top == i ? j : i;
+        if (t.y[i] == t.y[j]) continue;  // Горизонтальное - строк не покрывает
+        topX[edgeCount] = t.x[top];
+        topY[edgeCount] = t.y[top];
+        bottomY[edgeCount] = t.y[bottom];
+        slope[edgeCount] = (t.x[bottom] - t.x[top]) / (t.y[bottom] - t.y[top]);
+        ++edgeCount;
+    }
+
+    for (int row = firstRow; row <= lastRow; ++row) {
+        float y = float(row), crossing[2];
+        int found = 0;
+        for (int e = 0; e < edgeCount && found < 2; ++e) {
+            if (y >= topY[e] && y < bottomY[e]) crossing[found++] = topX[e] + (y - topY[e]) * slope[e];
+        }
+        if (found < 2) continue;
+        float left = std::min(crossing[0], crossing[1]), right = std::max(crossing[0], crossing[1]);
+        int from = std::max(ceilPixel(left, rect.x0, rect.x1), firstColumn);
+        int to = std::min(ceilPixel(right, rect.x0, rect.x1) - 1, lastColumn);
+        if (from > to) continue;
+
+        float depth = t.z0 + t.dzdx * (float(from) - t.x[0]) + t.dzdy * (y - t.y[0]);
+        size_t pixel = size_t(row) * width_ + from;
+        for (int x = from; x <= to; ++x, ++pixel, depth += t.dzdx) {
+            if (depth < depth_[pixel]) {
+                depth_[pixel] = depth;
+                color_[pixel] = t.color;
+            }
+        }
+    }
+}
+
+void SoftwareRasterizer::DrawTriangles(std::span<const ScreenVertex> vertices,
+                                       std::span<const uint32_t> triangles,
+                                       std::span<const uint32_t> colors, bool cullBackFaces) {
+    size_t triangleCount = std::min(triangles.size() / 3, colors.size());
+    if (triangleCount == 0 || getTileCount() == 0) return;
+    size_t blocks = prepareBins(triangle_bins_, triangleCount);
+    size_t perBlock = (triangleCount + blocks - 1) / blocks;
+    size_t tileCount = getTileCount();
+
+    // 1. Площадь, отсечение, плоскость глубины, разложение по плиткам
+    pool_.ParallelFor(blocks, [&](size_t block) {
+        if (isAbandoned()) return;
+        std::vector<Triangle>* bins = triangle_bins_.data() + block * tileCount;
+        size_t end = std::min(triangleCount, (block + 1) * perBlock);
+        Triangle triangle;
+        for (size_t i = block * perBlock; i < end; ++i) {
+            const uint32_t* corner = triangles.data() + i * 3;
+            if (!setupTriangle(vertices[corner[0]], vertices[corner[1]], vertices[corner[2]],
+                               cullBackFaces, triangle)) {
+                continue;
+            }
+            triangle.color = colors[i];
+            for (int ty = triangle.min_y / kTileSize; ty <= triangle.max_y / kTileSize; ++ty) {
+                for (int tx = triangle.min_x / kTileSize; tx <= triangle.max_x / kTileSize; ++tx) {
+                    bins[ty * tiles_x_ + tx].push_back(triangle);
+                }
+            }
+        }
+    });
+
+    // 2. Развертка по плиткам в порядке номеров треугольников
+    pool_.ParallelFor(tileCount, [&](size_t tile) {
+        if (isAbandoned()) return;
+        TileRect rect = getTileRect(tile);
+        for (size_t block = 0; block < blocks; ++block) {
+            for (const Triangle& triangle : triangle_bins_[block * tileCount + tile]) {
+                rasterTriangle(triangle, rect);
+            }
+        }
+    });
+}
+
+void SoftwareRasterizer::DrawPoints(std::span<const ScreenVertex> vertices, int size,
+                                    uint32_t color) {
+    size_t count = vertices.size();
+    if (count == 0 || size <= 0 || getTileCount() == 0) return;
+    size_t blocks = prepareBins(point_bins_, count);
+    size_t perBlock = (count + blocks - 1) / blocks;
+    size_t tileCount = getTileCount();
+
+    pool_.ParallelFor(blocks, [&](size_t block) {
+        if (isAbandoned()) return;
+        std::vector<uint32_t>* bins = point_bins_.data() + block * tileCount;
+        size_t end = std::min(count, (block + 1) * perBlock);
+        for (size_t i = block * perBlock; i < end; ++i) {
+            const ScreenVertex& v = vertices[i];
+            if (!std::isfinite(v.x) || !std::isfinite(v.y)) continue;
+            if (v.x < -size || v.y < -size || v.x > width_ + size || v.y > height_ + size) continue;
+            int left = int(std::lround(v.x)) - size / 2, top = int(std::lround(v.y)) - size / 2;
+            int x0 = std::max(left, 0), x1 = std::min(left + size - 1, width_ - 1);
+            int y0 = std::max(top, 0), y1 = std::min(top + size - 1, height_ - 1);
+            if (x0 > x1 || y0 > y1) continue;
+            for (int ty = y0 / kTileSize; ty <= y1 / kTileSize; ++ty) {
+                for (int tx = x0 / kTileSize; tx <= x1 / kTileSize; ++tx) {
+                    bins[ty * tiles_x_ + tx].push_back(uint32_t(i));
+                }
+            }
+        }
+    });
+
+    pool_.ParallelFor(tileCount, [&](size_t tile) {
+        if (isAbandoned()) return;
+        TileRect rect = getTileRect(tile);
+        for (size_t block = 0; block < blocks; ++block) {
+            for (uint32_t i : point_bins_[block * tileCount + tile]) {
+                rasterPoint(vertices[i], size, rect, color);
+            }
+        }
+    });
+}
+
+}  // namespace s21
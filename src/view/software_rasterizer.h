@@ -0,0 +1,157 @@
+// SOFTWARE_RASTERIZER.H - Многопоточный программный растеризатор линий, точек и треугольников
+//
+// ЗАЧЕМ НУЖЕН:
+// QPainter рисует в одном потоке. На машинах без GPU (серверы рендеринга)
+// кадр большого каркаса упирается в одно ядро. Растеризатор рисует отрезки,
+// точки и залитые треугольники сам, в собственный буфер кадра, разбивая
+// экран на плитки (tiles), которые обрабатываются параллельно на ThreadPool.
+// Залитые грани через QPainter пришлось бы сортировать по глубине
+// (алгоритм художника) - для миллиона треугольников это слишком медленно,
+// здесь видимость решает буфер глубины.
+//
+// ЧТО СОДЕРЖИТ:
+// - SoftwareRasterizer класс - буфер цвета (ARGB32 premultiplied), буфер
+//   глубины и растеризация отрезков (целочисленный Брезенхэм), точек и
+//   треугольников (построчная развертка, scanline)
+//
+// КАК РАБОТАЕТ:
+// 1. Экран делится на плитки kTileSize x kTileSize пикселей
+// 2. Подготовка (параллельно по блокам примитивов): отрезок отсекается по
+//    экрану (Лианг-Барски), концы округляются до пикселей, отрезок
+//    раскладывается (binning) ровно по тем плиткам, через которые проходит
+// 3. Растеризация (параллельно по плиткам): каждая плитка рисует свои
+//    примитивы в порядке их номеров, только пиксели внутри плитки.
+//    Пиксель отрезка вычисляется по формуле Брезенхэма от начала отрезка,
+//    поэтому куски одного отрезка в разных плитках стыкуются без швов
+// 4. Тест глубины (по желанию): пиксель пишется, если глубина меньше
+//    сохраненной; при равенстве остается первый примитив
+// 5. Результат не зависит от числа потоков: порядок записи в каждый
+//    пиксель тот же, что при последовательной отрисовке
+// 5a. Отмена (SetAbandonCheck): каждый блок подготовки и каждая плитка
+//    сначала спрашивают проверку; после отмены оставшиеся задачи сразу
+//    выходят, буфер остается недорисованным (кадр выбрасывается)
+// 6. Треугольники: подготовка считает удвоенную площадь на экране (знак -
+//    обход: лицевые грани, против часовой стрелки в OBJ, на экране с осью Y
+//    вниз идут по часовой, площадь < 0), отбрасывает нелицевые (по желанию)
+//    и вырожденные, плоскость глубины z = z0 + dz/dx * x + dz/dy * y и
+//    раскладывает треугольник по плиткам его габаритного прямоугольника
+// 7. Развертка: строка пикселей y пересекает ровно два ребра треугольника
+//    (ребро покрывает строки [y верхнего конца, y нижнего) - горизонтальные
+//    ребра не участвуют), пиксели x в [левое, правое) пересечение. Ребро
+//    считается от верхнего конца в обоих соседних треугольниках, поэтому
+//    общее ребро дает одно и то же пересечение: пиксели на стыке
+//    закрашиваются ровно один раз, без щелей. Тест глубины для граней
+//    включен всегда
+//
+// ОГРАНИЧЕНИЯ:
+// - Линии толщиной 1 пиксель, без сглаживания
+// - Треугольник с вершиной за ближней плоскостью центральной проекции
+//   (NaN в ProjectionCache) отбрасывается целиком - без обрезки по плоскости
+// - Лицевая сторона определяется по обходу: у модели с отрицательным
+//   масштабом (зеркало) отсечение убирает не те грани
+//
+// Без зависимостей от Qt. Все в namespace s21
+
+#ifndef SOFTWARE_RASTERIZER_H_
+#define SOFTWARE_RASTERIZER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "../model/mesh_codec.h"  // EdgeStream
+#include "../model/parallel.h"    // ThreadPool
+#include "projection.h"           // ScreenVertex
+
+namespace s21 {
+
+class SoftwareRasterizer {
+public:
+    static constexpr int kTileSize = 64;
+
+    explicit SoftwareRasterizer(ThreadPool& pool = ThreadPool::Shared());
+
+    void Resize(int width, int height);   // Буферы не пересоздаются при том же размере
+    void Clear(uint32_t color);           // Цвет и глубина (+inf)
+
+    void SetDepthTest(bool enabled) { depth_test_ = enabled; }
+    bool IsDepthTestEnabled() const { return depth_test_; }
+    // nullptr - без отмены; проверка должна жить, пока идет отрисовка
+    void SetAbandonCheck(const AbandonCheck* check) { abandon_ = check; }
+
+    // Отрезки между вершинами по парам индексов (b0 e0 b1 e1 ...)
+    void DrawLines(std::span<const ScreenVertex> vertices, std::span<const uint32_t> edges,
+                   uint32_t color);
+    // То же для сжатых ребер: блоки раскодируются в задачах подготовки
+    void DrawLines(std::span<const ScreenVertex> vertices, const EdgeStream& edges, uint32_t color);
+    // Квадраты size x size пикселей с центром в вершинах
+    void DrawPoints(std::span<const ScreenVertex> vertices, int size, uint32_t color);
+    // Залитые треугольники (a0 b0 c0 a1 b1 c1 ...) с тестом глубины, цвет -
+    // colors[номер треугольника]; cullBackFaces - не рисовать нелицевые
+    void DrawTriangles(std::span<const ScreenVertex> vertices, std::span<const uint32_t> triangles,
+                       std::span<const uint32_t> colors, bool cullBackFaces);
+
+    int GetWidth() const { return width_; }
+    int GetHeight() const { return height_; }
+    const uint32_t* GetPixels() const { return color_.data(); }  // Строка = width пикселей
+    uint32_t* GetPixels() { return color_.data(); }
+
+private:
+    // Отрезок в пикселях после отсечения, по главной оси (x при x_major, иначе y)
+    // и второстепенной: major0 <= major1
+    struct Segment {
+        int major0, minor0, major1, minor1;
+        float z0, z1;
+        bool x_major;
+    };
+
+    // Треугольник на экране: вершины, плоскость глубины, строки и столбцы
+    // пикселей габаритного прямоугольника включительно (внутри экрана)
+    struct Triangle {
+        float x[3], y[3];
+        float z0, dzdx, dzdy;   // z(x, y) = z0 + dzdx * (x - x[0]) + dzdy * (y - y[0])
+        int min_x, min_y, max_x, max_y;
+        uint32_t color;
+    };
+
+    // Пиксели плитки включительно
+    struct TileRect {
+        int x0, y0, x1, y1;
+    };
+
+    ThreadPool& pool_;
+    int width_ = 0;
+    int height_ = 0;
+    int tiles_x_ = 0;
+    int tiles_y_ = 0;
+    std::vector<uint32_t> color_;
+    std::vector<float> depth_;
+    bool depth_test_ = false;
+    const AbandonCheck* abandon_ = nullptr;
+
+    // [блок * число плиток + плитка] -> отрезки (копии: плитка читает их подряд)
+    // или номера вершин; память сохраняется между кадрами
+    std::vector<std::vector<Segment>> segment_bins_;
+    std::vector<std::vector<uint32_t>> point_bins_;
+    std::vector<std::vector<Triangle>> triangle_bins_;
+
+    size_t getTileCount() const { return size_t(tiles_x_) * tiles_y_; }
+    bool isAbandoned() const { return abandon_ && (*abandon_)(); }
+    TileRect getTileRect(size_t tile) const;
+    template <typename T>
+    size_t prepareBins(std::vector<std::vector<T>>& bins, size_t primitiveCount) const;
+    void binSegment(const Segment& segment, std::vector<Segment>* bins) const;
+    void rasterSegmentBins(size_t blocks, uint32_t color);
+    void rasterSegment(const Segment& segment, const TileRect& rect, uint32_t color);
+    void rasterPoint(const ScreenVertex& vertex, int size, const TileRect& rect, uint32_t color);
+    void rasterTriangle(const Triangle& triangle, const TileRect& rect);
+    bool setupTriangle(const ScreenVertex& a, const ScreenVertex& b, const ScreenVertex& c,
+                       bool cullBackFaces, Triangle& triangle) const;
+    void plot(int x, int y, float depth, uint32_t color);
+    bool setupSegment(const ScreenVertex& a, const ScreenVertex& b, Segment& segment) const;
+};
+
+}  // namespace s21
+
+#endif  // SOFTWARE_RASTERIZER_H_